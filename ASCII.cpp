@@ -1,4 +1,4 @@
-#include "Ascii.h"
+#include "ASCII.h"
 
 void setColor(const std::string& colorCode) {
     std::cout << colorCode;
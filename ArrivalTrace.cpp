@@ -0,0 +1,368 @@
+/**
+ * @file ArrivalTrace.cpp
+ * @brief Arrival trace reader, writer and batch implementation.
+ *
+ * The reader keeps one window of the file mapped and slides it forward
+ * whenever less than a whole record is left in it, so rows are decoded
+ * straight from the mapping and never copied.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "ArrivalTrace.h"
+#include <algorithm>  // For is_sorted, min, stable_sort
+#include <climits>    // For INT_MAX
+#include <cstring>    // For memchr, memcmp
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char arrivalMagic[8] = {'S', 'C', 'H', 'A', 'R', 'R', 'V', '1'};
+static const size_t writeChunk = 1 << 20;
+
+// Constructor and Destructor
+ArrivalTraceReader::ArrivalTraceReader()
+    : fd(-1), fileSize(0), window(nullptr), windowSize(0), windowOffset(0), position(0), format(ArrivalFormat::CSV),
+      upcoming{0, 0, 0}, hasUpcoming(false), previousTick(0), rows(0), lineNumber(0), failed(false) {}
+
+ArrivalTraceReader::~ArrivalTraceReader() {
+    close();
+}
+
+void ArrivalTraceReader::unmap() {
+#ifndef _WIN32
+    if (window != nullptr) {
+        munmap(const_cast<uint8_t*>(window), windowSize);
+    }
+#endif
+    window = nullptr;
+    windowSize = 0;
+}
+
+void ArrivalTraceReader::close() {
+    unmap();
+#ifndef _WIN32
+    if (fd >= 0) {
+        ::close(fd);
+    }
+#endif
+    fd = -1;
+    fileSize = 0;
+    windowOffset = 0;
+    position = 0;
+    hasUpcoming = false;
+}
+
+bool ArrivalTraceReader::mapWindow(uint64_t offset) {
+    unmap();
+#ifdef _WIN32
+    (void)offset;
+    return false;
+#else
+    uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    windowOffset = offset - offset % pageSize;
+    position = static_cast<size_t>(offset - windowOffset);
+    if (windowOffset >= fileSize) {
+        return true;  // Nothing left to map
+    }
+
+    windowSize = static_cast<size_t>(std::min<uint64_t>(windowBytes, fileSize - windowOffset));
+    void* mapping = mmap(nullptr, windowSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(windowOffset));
+    if (mapping == MAP_FAILED) {
+        printf("Could not map the arrival trace\n");
+        windowSize = 0;
+        return false;
+    }
+    madvise(mapping, windowSize, MADV_SEQUENTIAL);
+    window = static_cast<const uint8_t*>(mapping);
+    return true;
+#endif
+}
+
+// Map the first window and pick the format from the magic
+bool ArrivalTraceReader::open(const std::string& path) {
+    close();
+    hasUpcoming = false;
+    previousTick = 0;
+    rows = 0;
+    lineNumber = 0;
+    failed = false;
+#ifdef _WIN32
+    printf("Arrival traces need mmap, which this build does not support\n");
+    (void)path;
+    return false;
+#else
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        printf("Could not open arrival trace %s\n", path.c_str());
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        printf("Could not read arrival trace %s\n", path.c_str());
+        close();
+        return false;
+    }
+    fileSize = static_cast<uint64_t>(info.st_size);
+    if (!mapWindow(0)) {
+        close();
+        return false;
+    }
+
+    format = ArrivalFormat::CSV;
+    if (windowSize >= sizeof(arrivalMagic) && memcmp(window, arrivalMagic, sizeof(arrivalMagic)) == 0) {
+        format = ArrivalFormat::BINARY;
+        position = sizeof(arrivalMagic);
+    }
+    return true;
+#endif
+}
+
+// Slide the window forward once a record might run past its end, false if nothing is left
+bool ArrivalTraceReader::refill() {
+    if (windowSize - position < maxRecordBytes && windowOffset + windowSize < fileSize) {
+        if (!mapWindow(windowOffset + position)) {
+            failed = true;
+            return false;
+        }
+    }
+    return position < windowSize;
+}
+
+bool ArrivalTraceReader::readVarint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && position < windowSize; shift += 7) {
+        uint8_t byte = window[position++];
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ArrivalTraceReader::readBinaryRow(Arrival& arrival) {
+    if (!refill()) {
+        return false;
+    }
+    uint64_t delta, thread, size;
+    if (!readVarint(delta) || !readVarint(thread) || !readVarint(size)) {
+        printf("Arrival trace is truncated after row %lld\n", rows);
+        failed = true;
+        return false;
+    }
+    if (size < 1 || size > INT_MAX || delta > static_cast<uint64_t>(LLONG_MAX - previousTick)) {
+        printf("Arrival trace row %lld is out of range\n", rows + 1);
+        failed = true;
+        return false;
+    }
+    arrival.tick = previousTick + static_cast<long long>(delta);
+    arrival.thread = static_cast<size_t>(thread);
+    arrival.size = static_cast<int>(size);
+    return true;
+}
+
+// Parse a non-negative decimal field, skipping spaces around it
+static bool parseField(const char*& text, const char* end, unsigned long long& value) {
+    while (text < end && (*text == ' ' || *text == '\t')) {
+        text++;
+    }
+    const char* start = text;
+    value = 0;
+    while (text < end && *text >= '0' && *text <= '9') {
+        unsigned digit = static_cast<unsigned>(*text - '0');
+        if (value > (ULLONG_MAX - digit) / 10) {
+            return false;
+        }
+        value = value * 10 + digit;
+        text++;
+    }
+    bool parsed = text > start;
+    while (text < end && (*text == ' ' || *text == '\t')) {
+        text++;
+    }
+    return parsed;
+}
+
+// "tick,thread,size" lines, blank lines and lines starting with # are skipped, as is a header on the first line
+bool ArrivalTraceReader::readCsvRow(Arrival& arrival) {
+    while (refill()) {
+        const char* line = reinterpret_cast<const char*>(window + position);
+        size_t available = windowSize - position;
+        const char* newline = static_cast<const char*>(memchr(line, '\n', std::min(available, maxRecordBytes)));
+        if (newline == nullptr && available >= maxRecordBytes) {
+            printf("Arrival trace line %lld is too long\n", lineNumber + 1);
+            failed = true;
+            return false;
+        }
+        const char* end = (newline != nullptr) ? newline : line + available;
+        position += static_cast<size_t>(end - line) + (newline != nullptr ? 1 : 0);
+        lineNumber++;
+
+        if (end > line && end[-1] == '\r') {
+            end--;
+        }
+        const char* text = line;
+        while (text < end && (*text == ' ' || *text == '\t')) {
+            text++;
+        }
+        if (text == end || *text == '#' || (lineNumber == 1 && (*text < '0' || *text > '9'))) {
+            continue;
+        }
+
+        unsigned long long tick, thread, size;
+        bool parsed = parseField(text, end, tick) && text < end && *text++ == ',' && parseField(text, end, thread) &&
+                      text < end && *text++ == ',' && parseField(text, end, size) && text == end;
+        if (!parsed || tick > LLONG_MAX || size < 1 || size > INT_MAX) {
+            printf("Malformed arrival on line %lld, expected tick,thread,size\n", lineNumber);
+            failed = true;
+            return false;
+        }
+        arrival.tick = static_cast<long long>(tick);
+        arrival.thread = static_cast<size_t>(thread);
+        arrival.size = static_cast<int>(size);
+        return true;
+    }
+    return false;
+}
+
+bool ArrivalTraceReader::readRow(Arrival& arrival) {
+    if (failed || window == nullptr) {
+        return false;
+    }
+    bool read = (format == ArrivalFormat::BINARY) ? readBinaryRow(arrival) : readCsvRow(arrival);
+    if (!read) {
+        return false;
+    }
+    if (arrival.tick < previousTick) {
+        printf("Arrival trace row %lld is earlier than the row before it\n", rows + 1);
+        failed = true;
+        return false;
+    }
+    previousTick = arrival.tick;
+    rows++;
+    return true;
+}
+
+bool ArrivalTraceReader::next(long long tick, Arrival& arrival) {
+    if (!hasUpcoming) {
+        if (!readRow(upcoming)) {
+            return false;
+        }
+        hasUpcoming = true;
+    }
+    if (upcoming.tick > tick) {
+        return false;
+    }
+    arrival = upcoming;
+    hasUpcoming = false;
+    return true;
+}
+
+long long ArrivalTraceReader::rowsRead() const {
+    return rows;
+}
+
+bool ArrivalTraceReader::hasFailed() const {
+    return failed;
+}
+
+// Constructor and Destructor
+ArrivalTraceWriter::ArrivalTraceWriter() : file(nullptr), previousTick(0), failed(false) {}
+
+ArrivalTraceWriter::~ArrivalTraceWriter() {
+    if (file != nullptr) {
+        close();
+    }
+}
+
+void ArrivalTraceWriter::putVarint(uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void ArrivalTraceWriter::flushBuffer() {
+    if (!buffer.empty() && fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+        failed = true;
+    }
+    buffer.clear();
+}
+
+bool ArrivalTraceWriter::open(const std::string& path) {
+    file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        printf("Could not open %s for writing\n", path.c_str());
+        return false;
+    }
+    buffer.assign(arrivalMagic, arrivalMagic + sizeof(arrivalMagic));
+    previousTick = 0;
+    failed = false;
+    return true;
+}
+
+bool ArrivalTraceWriter::write(const Arrival& arrival) {
+    if (arrival.tick < previousTick) {
+        return false;
+    }
+    putVarint(static_cast<uint64_t>(arrival.tick - previousTick));
+    putVarint(arrival.thread);
+    putVarint(static_cast<uint64_t>(arrival.size));
+    previousTick = arrival.tick;
+    if (buffer.size() >= writeChunk) {
+        flushBuffer();
+    }
+    return true;
+}
+
+bool ArrivalTraceWriter::close() {
+    if (file == nullptr) {
+        return false;
+    }
+    flushBuffer();
+    bool closed = (fclose(file) == 0) && !failed;
+    file = nullptr;
+    if (!closed) {
+        printf("Could not write the arrival trace\n");
+    }
+    return closed;
+}
+
+ArrivalBatch::ArrivalBatch() : cursor(0), ignoredCount(0) {}
+
+void ArrivalBatch::collect(ArrivalSource& source, long long tick, size_t threadCount) {
+    due.clear();
+    cursor = 0;
+    Arrival arrival;
+    while (source.next(tick, arrival)) {
+        if (arrival.thread < threadCount) {
+            due.push_back(arrival);
+        } else {
+            ignoredCount++;
+        }
+    }
+
+    auto byThread = [](const Arrival& left, const Arrival& right) { return left.thread < right.thread; };
+    if (!std::is_sorted(due.begin(), due.end(), byThread)) {
+        std::stable_sort(due.begin(), due.end(), byThread);
+    }
+}
+
+bool ArrivalBatch::next(size_t threadIndex, Arrival& arrival) {
+    if (cursor < due.size() && due[cursor].thread == threadIndex) {
+        arrival = due[cursor++];
+        return true;
+    }
+    return false;
+}
+
+long long ArrivalBatch::ignored() const {
+    return ignoredCount;
+}
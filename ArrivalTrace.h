@@ -0,0 +1,120 @@
+/**
+ * @file ArrivalTrace.h
+ * @brief Contains the arrival source interface and the arrival trace reader and writer classes
+ *
+ * Replays recorded arrivals instead of generated ones. A trace is a list of
+ * (tick, thread, size) rows in tick order, either as CSV text or in a
+ * compact binary form: an 8 byte magic, then per row varint(tick - previous
+ * tick), varint(thread) and varint(size).
+ *
+ * The reader maps a fixed size window of the file and decodes rows from it
+ * on demand, sliding the window along as it goes, so memory use stays the
+ * same for a trace of any length.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdio.h>  // For FILE
+#include <string>
+#include <vector>
+
+// One task arrival, size is the task's requested time
+struct Arrival {
+    long long tick;
+    size_t thread;
+    int size;
+};
+
+// Anything that hands out arrivals in tick order
+class ArrivalSource {
+public:
+    virtual ~ArrivalSource() {}
+
+    // Next arrival due at or before tick, false if the next one is later or there are none left
+    virtual bool next(long long tick, Arrival& arrival) = 0;
+};
+
+enum class ArrivalFormat { CSV, BINARY };
+
+class ArrivalTraceReader : public ArrivalSource {
+private:
+    int fd;
+    uint64_t fileSize;
+    const uint8_t* window;  // Mapped part of the file
+    size_t windowSize;
+    uint64_t windowOffset;  // File offset of the window, a multiple of the page size
+    size_t position;        // Next byte to decode, relative to the window
+    ArrivalFormat format;
+
+    Arrival upcoming;       // Decoded but not yet due
+    bool hasUpcoming;
+    long long previousTick;
+    long long rows;
+    long long lineNumber;   // CSV line of the row being decoded, for error messages
+    bool failed;
+
+    bool mapWindow(uint64_t offset);  // Map the window holding offset, the cursor moves with it
+    void unmap();
+    bool refill();                    // Slide the window if a whole record may not fit in what is left
+    bool readRow(Arrival& arrival);   // Decode the next row, false at the end or on a malformed row
+    bool readCsvRow(Arrival& arrival);
+    bool readBinaryRow(Arrival& arrival);
+    bool readVarint(uint64_t& value);
+public:
+    static constexpr size_t windowBytes = 16 << 20;
+    static constexpr size_t maxRecordBytes = 4096;  // Longest row, CSV lines included
+
+    // Constructor and Destructor
+    ArrivalTraceReader();
+    ~ArrivalTraceReader();
+
+    bool open(const std::string& path);  // Prints the problem and returns false if the file can't be read
+    void close();
+
+    bool next(long long tick, Arrival& arrival);
+
+    long long rowsRead() const;
+    bool hasFailed() const;  // A row was malformed or out of order, the rest of the trace is skipped
+};
+
+// Writes the binary arrival format, rows must come in tick order
+class ArrivalTraceWriter {
+private:
+    FILE* file;
+    std::vector<uint8_t> buffer;
+    long long previousTick;
+    bool failed;
+
+    void putVarint(uint64_t value);
+    void flushBuffer();
+public:
+    // Constructor and Destructor
+    ArrivalTraceWriter();
+    ~ArrivalTraceWriter();  // Closes the trace if it is still open
+
+    bool open(const std::string& path);
+    bool write(const Arrival& arrival);  // False if the row is earlier than the one before it
+    bool close();                        // Returns false if any write failed
+};
+
+// Arrivals due at one tick, handed out thread by thread for the schedulers' release loops
+class ArrivalBatch {
+private:
+    std::vector<Arrival> due;  // Sorted by thread, stable so each thread keeps its trace order
+    size_t cursor;
+    long long ignoredCount;
+public:
+    ArrivalBatch();
+
+    // Take everything due by tick from source, arrivals for threads past threadCount are counted and dropped
+    void collect(ArrivalSource& source, long long tick, size_t threadCount);
+
+    // Next arrival of the thread, call with ascending thread indices after collect
+    bool next(size_t threadIndex, Arrival& arrival);
+
+    long long ignored() const;
+};
@@ -0,0 +1,214 @@
+/**
+ * @file AsyncTimelineRenderer.cpp
+ * @brief Asynchronous timeline renderer implementation.
+ *
+ * The simulation thread only builds records and pushes them into the ring.
+ * The drawing thread drains the ring, formats the records through a
+ * TimelineRenderer and writes the result once per refresh.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "AsyncTimelineRenderer.h"
+#include "ASCII.h"  // For color codes
+#include "TimelineRenderer.h"
+#include <chrono>
+
+#ifdef _WIN32
+#include <io.h>
+#define isTerminal(fd) (_isatty(fd) != 0)
+#define STDOUT_FD 1
+#else
+#include <unistd.h>
+#define isTerminal(fd) (isatty(fd) != 0)
+#define STDOUT_FD STDOUT_FILENO
+#endif
+
+using namespace std;
+
+// How long the simulation sleeps when the ring is full and it has to wait
+static const chrono::microseconds waitForRoom(100);
+// How long the drawing thread sleeps when the ring is empty and nothing is dropped
+static const chrono::milliseconds waitForRecords(1);
+
+// Constructor and Destructor
+AsyncTimelineRenderer::AsyncTimelineRenderer(bool dropFrames)
+    : ring(ringCapacity), dropFrames(dropFrames), stopping(false), flushesDone(0) {}
+
+AsyncTimelineRenderer::~AsyncTimelineRenderer() {
+    flush();
+    if (drawingThread.joinable()) {
+        stopping.store(true, memory_order_release);
+        drawingThread.join();
+    }
+}
+
+bool AsyncTimelineRenderer::outputIsTerminal() {
+    return isTerminal(STDOUT_FD);
+}
+
+long long AsyncTimelineRenderer::rowsDropped() const {
+    return droppedRows;
+}
+
+void AsyncTimelineRenderer::addRecord(RecordKind kind, const string* color, const char* text, long long value) {
+    Record record;
+    record.kind = kind;
+    record.color = color;
+    if (kind == RecordKind::ROW_END || kind == RecordKind::SKIPPED) {
+        record.value = value;
+    } else {
+        record.text = text;
+    }
+    row.push_back(record);
+}
+
+void AsyncTimelineRenderer::write(const char* text) {
+    if (!skippingFrame) {
+        addRecord(RecordKind::TEXT, nullptr, text, 0);
+    }
+}
+
+void AsyncTimelineRenderer::writeCell(const string& colorCode, const char* glyph) {
+    if (!skippingFrame) {
+        addRecord(RecordKind::CELL, &colorCode, glyph, 0);
+    }
+}
+
+// A new frame may be shown again, after a note of what was skipped before it
+void AsyncTimelineRenderer::newFrame() {
+    skippingFrame = false;
+    if (skippedRows > 0) {
+        addRecord(RecordKind::SKIPPED, nullptr, nullptr, skippedRows);
+    }
+    addRecord(RecordKind::FRAME, nullptr, nullptr, 0);
+}
+
+void AsyncTimelineRenderer::endRow(long long timeUnit) {
+    if (skippingFrame) {
+        skippedRows++;
+        droppedRows++;
+        return;
+    }
+    addRecord(RecordKind::ROW_END, nullptr, nullptr, timeUnit);
+    pushRow();
+}
+
+void AsyncTimelineRenderer::pushRow() {
+    if (!drawingThread.joinable()) {
+        drawingThread = thread(&AsyncTimelineRenderer::draw, this);
+    }
+    if (!dropFrames) {
+        pushWaiting(row.data(), row.size());
+    } else if (ring.tryPush(row.data(), row.size())) {
+        skippedRows = 0;
+    } else {
+        // The terminal fell behind, drop this row and the rest of its frame
+        skippingFrame = true;
+        skippedRows++;
+        droppedRows++;
+    }
+    row.clear();
+}
+
+// Rows larger than the ring go in pieces, the drawing thread doesn't need them whole
+void AsyncTimelineRenderer::pushWaiting(const Record* records, size_t count) {
+    size_t piece = ring.capacity() / 2;
+    while (count > 0) {
+        size_t pushing = count < piece ? count : piece;
+        while (!ring.tryPush(records, pushing)) {
+            this_thread::sleep_for(waitForRoom);
+        }
+        records += pushing;
+        count -= pushing;
+    }
+}
+
+void AsyncTimelineRenderer::flush() {
+    if (!drawingThread.joinable() && row.empty()) {
+        return;  // Nothing was ever drawn
+    }
+    if (!drawingThread.joinable()) {
+        drawingThread = thread(&AsyncTimelineRenderer::draw, this);
+    }
+
+    // Anything of an unfinished row goes too, like TimelineRenderer::flush, and the note of any rows skipped last
+    if (skippedRows > 0) {
+        addRecord(RecordKind::SKIPPED, nullptr, nullptr, skippedRows);
+        skippedRows = 0;
+    }
+    addRecord(RecordKind::FLUSH, nullptr, nullptr, 0);
+    pushWaiting(row.data(), row.size());
+    row.clear();
+    flushesRequested++;
+    while (flushesDone.load(memory_order_acquire) < flushesRequested) {
+        this_thread::sleep_for(waitForRoom);
+    }
+}
+
+void AsyncTimelineRenderer::drawRecord(TimelineRenderer& output, const Record& record) {
+    switch (record.kind) {
+        case RecordKind::CELL:
+            output.writeCell(*record.color, record.text);
+            break;
+        case RecordKind::TEXT:
+            output.write(record.text);
+            break;
+        case RecordKind::ROW_END:
+            output.endRow(record.value);
+            break;
+        case RecordKind::FRAME:
+            output.newFrame();
+            break;
+        case RecordKind::SKIPPED: {
+            string note = "... " + to_string(record.value) + " time units not drawn, the terminal fell behind\n";
+            output.setColor(COLOR_WHITE);
+            output.write(note.c_str());
+            break;
+        }
+        case RecordKind::FLUSH:
+            output.flush();
+            flushesDone.fetch_add(1, memory_order_release);
+            break;
+    }
+}
+
+// Drain the ring, write it all out, then wait for the next refresh
+// On a terminal the refreshes keep a fixed rate, otherwise the thread keeps draining and only sleeps once
+// a pass finds the ring empty, leaving TimelineRenderer to write in large batches meanwhile
+void AsyncTimelineRenderer::draw() {
+    TimelineRenderer output;
+    vector<Record> batch(4096);
+    chrono::steady_clock::time_point nextRefresh = chrono::steady_clock::now();
+
+    for (;;) {
+        // Checked before draining, so everything pushed before the stop is still drawn
+        bool stopRequested = stopping.load(memory_order_acquire);
+        size_t drawn = 0;
+        size_t popped;
+        while ((popped = ring.pop(batch.data(), batch.size())) > 0) {
+            for (size_t i = 0; i < popped; ++i) {
+                drawRecord(output, batch[i]);
+            }
+            drawn += popped;
+        }
+        if (stopRequested) {
+            output.flush();
+            return;
+        }
+
+        if (dropFrames) {
+            output.flush();
+            nextRefresh += chrono::milliseconds(refreshMillis);
+            chrono::steady_clock::time_point now = chrono::steady_clock::now();
+            if (nextRefresh < now) {
+                nextRefresh = now;  // Drawing took longer than a refresh, start counting again from here
+            }
+            this_thread::sleep_until(nextRefresh);
+        } else if (drawn == 0) {
+            output.flush();
+            this_thread::sleep_for(waitForRecords);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/**
+ * @file AsyncTimelineRenderer.h
+ * @brief Contains the asynchronous timeline renderer class definition
+ *
+ * Renderer for the scrolling thread status display that draws on its own
+ * thread, so a slow terminal doesn't hold up the simulation. The tick
+ * engine's cells go into a lock-free ring as compact records, a whole row
+ * at a time, and the renderer thread turns them into the same colored
+ * output as TimelineRenderer, writing it out at a fixed refresh rate.
+ *
+ * On a terminal, a row that doesn't fit in the ring is dropped along with
+ * the rest of its frame, and the next frame shown starts with a line
+ * saying how many time units were skipped. Written to a file or a pipe,
+ * nothing is dropped and the simulation waits for room instead, so the
+ * output is the same as TimelineRenderer's.
+ *
+ * Colors and glyphs are kept as pointers, so they must outlive the
+ * renderer, as the ASCII.h colors and string literals do.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "SpscRing.h"
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TimelineRenderer;
+
+class AsyncTimelineRenderer {
+private:
+    enum class RecordKind : unsigned char {
+        CELL,     // Colored glyph
+        TEXT,     // Uncolored text
+        ROW_END,  // Time label and newline, value is the time unit
+        FRAME,    // Frame boundary banner
+        SKIPPED,  // Note that value time units were not drawn
+        FLUSH     // Write everything out and tell the producer
+    };
+
+    struct Record {
+        RecordKind kind;
+        const std::string* color;  // Only for CELL
+        union {
+            const char* text;      // CELL and TEXT
+            long long value;       // ROW_END and SKIPPED
+        };
+    };
+
+    SpscRing<Record> ring;
+    std::vector<Record> row;       // Records of the row being built, pushed whole at endRow
+    bool dropFrames;               // Drop frames when the ring is full instead of waiting for room
+    bool skippingFrame = false;    // A row of this frame was dropped, so the rest of it is too
+    long long skippedRows = 0;     // Rows dropped since the last row that was shown
+    long long droppedRows = 0;     // Rows dropped over the renderer's lifetime
+    long long flushesRequested = 0;
+
+    std::thread drawingThread;                // Started by the first row, so an unused renderer costs nothing
+    std::atomic<bool> stopping;
+    std::atomic<long long> flushesDone;
+
+    void pushRow();                                       // Push row whole, waiting or dropping if it doesn't fit
+    void pushWaiting(const Record* records, size_t count);  // Push every record, waiting for room as long as it takes
+    void addRecord(RecordKind kind, const std::string* color, const char* text, long long value);
+    void draw();                                          // Body of the drawing thread
+    void drawRecord(TimelineRenderer& output, const Record& record);
+
+public:
+    static constexpr bool draws = true;  // Tells the tick engine to produce cells
+
+    static constexpr size_t ringCapacity = 1 << 16;  // Records, a few thousand rows of a small thread set
+    static constexpr int refreshMillis = 16;         // Time between draws on a terminal, about 60 a second
+
+    // Constructor and Destructor
+    explicit AsyncTimelineRenderer(bool dropFrames = outputIsTerminal());
+    ~AsyncTimelineRenderer();  // Writes out everything still queued
+
+    void write(const char* text);
+    void writeCell(const std::string& colorCode, const char* glyph);
+
+    void newFrame();                  // Frame boundary banner
+    void endRow(long long timeUnit);  // Time label and newline, hands the row to the drawing thread
+
+    void flush();  // Returns once everything queued so far is written to stdout
+
+    long long rowsDropped() const;  // Rows not drawn because the terminal fell behind
+    static bool outputIsTerminal();  // True if stdout is a terminal, where frames may be dropped
+};
@@ -0,0 +1,90 @@
+/**
+ * @file DaryHeap.h
+ * @brief Contains the d-ary heap class template
+ *
+ * Array backed min-heap where every node has Arity children. A wider node
+ * makes the tree shallower and keeps each sift step's children in one or two
+ * cache lines, so push, pop and replaceTop are O(log n) with few cache misses.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>  // For less
+#include <utility>
+#include <vector>
+
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4>
+class DaryHeap {
+private:
+    std::vector<T> items;  // Heap order, the children of i are i * Arity + 1 to i * Arity + Arity
+    Compare less;
+
+    void siftUp(std::size_t index) {
+        T item = std::move(items[index]);
+        while (index > 0) {
+            std::size_t parent = (index - 1) / Arity;
+            if (!less(item, items[parent])) {
+                break;
+            }
+            items[index] = std::move(items[parent]);
+            index = parent;
+        }
+        items[index] = std::move(item);
+    }
+
+    void siftDown(std::size_t index) {
+        T item = std::move(items[index]);
+        const std::size_t count = items.size();
+        for (;;) {
+            std::size_t firstChild = index * Arity + 1;
+            if (firstChild >= count) {
+                break;
+            }
+
+            // Smallest of up to Arity children
+            std::size_t lastChild = firstChild + Arity < count ? firstChild + Arity : count;
+            std::size_t best = firstChild;
+            for (std::size_t child = firstChild + 1; child < lastChild; ++child) {
+                if (less(items[child], items[best])) {
+                    best = child;
+                }
+            }
+            if (!less(items[best], item)) {
+                break;
+            }
+            items[index] = std::move(items[best]);
+            index = best;
+        }
+        items[index] = std::move(item);
+    }
+
+public:
+    void push(const T& item) {
+        items.push_back(item);
+        siftUp(items.size() - 1);
+    }
+
+    // Smallest element, the heap must not be empty
+    const T& top() const { return items.front(); }
+
+    void pop() {
+        items.front() = std::move(items.back());
+        items.pop_back();
+        if (!items.empty()) {
+            siftDown(0);
+        }
+    }
+
+    // Replace the smallest element, cheaper than a pop followed by a push
+    void replaceTop(const T& item) {
+        items.front() = item;
+        siftDown(0);
+    }
+
+    bool isEmpty() const { return items.empty(); }
+    std::size_t size() const { return items.size(); }
+    void clear() { items.clear(); }
+};
@@ -0,0 +1,287 @@
+/**
+ * @file EarliestDeadlineFirst.cpp
+ * @brief Earliest deadline first scheduler implementation.
+ *
+ * Example of a scheduler implemented using earliest deadline first scheduling.
+ * Each task's deadline is its thread's next release, and the thread whose
+ * front task is due soonest always runs.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "EarliestDeadlineFirst.h"
+#include "ASCII.h"  // For coloring
+#include "RateMonotonic.h"
+#include "SteadyState.h"
+#include "LatencyHistogram.h"
+#include "TickEngine.h"
+#include "AsyncTimelineRenderer.h"
+#include <algorithm>  // For min
+
+using namespace std;
+
+// Same thread tables as the rate monotonic examples, so the two can be compared directly
+vector<Thread> EDFScheduler::exampleThreadSet(ExampleType exampleType) {
+    return RateMonotonicScheduler::exampleThreadSet(exampleType);
+}
+
+// Constructor initializes threads and next release times based on example type
+EDFScheduler::EDFScheduler(ExampleType exampleType) : EDFScheduler(exampleThreadSet(exampleType)) {}
+
+// Constructor initializes threads and next release times from a loaded thread set
+EDFScheduler::EDFScheduler(const vector<Thread>& threadSet) {
+    threads.assign(threadSet);
+    taskDeadlines.resize(threads.count());
+
+    // Set initial next release times based on the threads' frequencies
+    for (int frequency : threads.frequencies) {
+        nextReleaseTimes.push_back(frequency);
+    }
+}
+
+// Destructor to clear the queues in each thread
+EDFScheduler::~EDFScheduler() {
+    for (TaskQueue& taskQueue : threads.taskQueues) {
+        while (!taskQueue.isEmpty()) {
+            taskQueue.pop();
+        }
+    }
+}
+
+// Example run with the scrolling thread status display
+void EDFScheduler::runExample() {
+    runTicks(10008, OutputLevel::TIMELINE);
+}
+
+// Run for any horizon, skipping all per-tick work unless the timeline is wanted
+void EDFScheduler::run(long long horizon, OutputLevel output) {
+    if (output == OutputLevel::TIMELINE || output == OutputLevel::LATENCY) {
+        runTicks(horizon, output);
+        return;
+    }
+
+    SimulationStats stats = simulate(horizon);
+    if (output == OutputLevel::SUMMARY) {
+        cout << "Total tasks created: " << stats.tasksCreated << endl;
+        cout << "Total tasks serviced: " << stats.tasksServiced << endl;
+        cout << "Deadline misses: " << stats.deadlineMisses << endl;
+    }
+}
+
+// Release a task for the thread if it is due, each due by the thread's next release
+int EDFScheduler::releaseTick(size_t threadIndex, long long time) {
+    if (time < nextReleaseTimes[threadIndex]) {
+        return 0;
+    }
+    nextReleaseTimes[threadIndex] += threads.frequencies[threadIndex];
+    addTask(threadIndex, time, nextReleaseTimes[threadIndex]);
+    return 1;
+}
+
+// Every thread has its own queue
+size_t EDFScheduler::releaseQueue(size_t threadIndex) {
+    return threadIndex;
+}
+
+// The thread whose front task is due first runs
+TickSelection EDFScheduler::selectTick() {
+    int runningThreadIndex = earliestDeadlineThread();
+    return {runningThreadIndex, runningThreadIndex != -1};
+}
+
+TickCell EDFScheduler::tickCell(size_t threadIndex, TickSelection selection, bool created) {
+    bool isRunning = (static_cast<int>(threadIndex) == selection.thread);
+
+    if (isRunning && created) {
+        // Turquoise if a task is both created and executed in this time unit
+        return {&COLOR_TURQUOISE, "█▓▒░"};
+    } else if (isRunning) {
+        // Green if this thread's task is due first
+        return {&COLOR_GREEN, "█▓▒░"};
+    } else if (created) {
+        // Yellow if a task is created but another is due sooner
+        return {&COLOR_YELLOW, "█▓▒░"};
+    } else if (!threads.taskQueues[threadIndex].isEmpty()) {
+        // Red if the thread has work waiting on an earlier deadline
+        return {&COLOR_RED, "█▓▒░"};
+    }
+    // Gray if no tasks are in the queue
+    return {&COLOR_GRAY, "░░░░"};
+}
+
+// Service the selected task for one tick, true if it finished
+bool EDFScheduler::serviceTick(TickSelection selection, long long time) {
+    if (!selection.hasTask) {
+        return false;
+    }
+    size_t threadIndex = static_cast<size_t>(selection.thread);
+    Task* runningTask = threads.taskQueues[threadIndex].top();
+    if (runningTask->getFirstRunTick() < 0) {
+        runningTask->setFirstRunTick(time);
+    }
+    runningTask->setServiced(runningTask->getServiced() + 1);
+
+    if (runningTask->getServiced() != runningTask->getRequested()) {
+        return false;
+    }
+    runningTask->setCompletionTick(time + 1);
+    tickLatencies[threadIndex].record(*runningTask, *taskDeadlines[threadIndex].top());
+    if (removeTopTask(threadIndex, time + 1)) {
+        tickMisses++;
+    }
+    return true;
+}
+
+// Main scheduler loop with scrolling thread status display
+void EDFScheduler::runTicks(long long horizon, OutputLevel output) {
+    tickMisses = 0;
+    tickLatencies.assign(threads.count(), ThreadLatency(horizon));
+
+    TickTotals totals;
+    if (output == OutputLevel::TIMELINE) {
+        AsyncTimelineRenderer renderer;  // Draws on its own thread, so a slow terminal doesn't hold up the run
+        totals = runTickEngine(*this, renderer, threads.count(), horizon, nullptr);
+    } else {
+        NullRenderer renderer;
+        totals = runTickEngine(*this, renderer, threads.count(), horizon, nullptr);
+    }
+    tickMisses += totals.tasksCreated - totals.tasksServiced - queuedNotYetDue(taskDeadlines, horizon);
+    recordUnfinished(horizon);
+
+    if (output != OutputLevel::NONE) {
+        cout << "Total tasks created: " << totals.tasksCreated << endl;
+        cout << "Total tasks serviced: " << totals.tasksServiced << endl;
+        cout << "Deadline misses: " << tickMisses << endl;
+    }
+    if (output == OutputLevel::TIMELINE || output == OutputLevel::LATENCY) {
+        printLatencyReport(tickLatencies);
+    }
+}
+
+void EDFScheduler::recordUnfinished(long long horizon) {
+    for (size_t i = 0; i < threads.count(); ++i) {
+        forEachQueued(taskDeadlines[i], [&](long long deadline) { tickLatencies[i].recordUnfinished(deadline, horizon); });
+    }
+}
+
+// Event-driven scheduler loop, jumps straight to the next release or task completion
+// Gives the same totals as runTicks over the same horizon, without the display
+SimulationStats EDFScheduler::simulate(long long horizon) {
+    SimulationStats stats = {0, 0, 0, 0, 0, 0, 0, 0};
+    vector<long long> firstReleases = nextReleaseTimes;
+
+    // The order only depends on the front deadlines, which the detector compares too
+    SteadyStateDetector steadyState;
+    steadyState.start(threads, horizon, 1);
+    vector<long long> frontDeadlines(threads.count(), 0);
+
+    long long timeCounter = 0;
+    long long nextRelease = 0;
+    while (timeCounter < horizon) {
+        // Once a hyperperiod repeats, every remaining whole one plays out the same way
+        if (timeCounter == steadyState.nextBoundary() && steadyState.atBoundary(threads, stats, queuedFrontDeadlines(frontDeadlines))) {
+            long long periods = (horizon - timeCounter) / steadyState.period();
+            long long skipped = periods * steadyState.period();
+            long long deadlineShift = periods * steadyState.deadlineShiftPerPeriod();
+            stats.tasksCreated += periods * steadyState.growthPerPeriod().tasksCreated;
+            stats.tasksServiced += periods * steadyState.growthPerPeriod().tasksServiced;
+            stats.deadlineMisses += periods * steadyState.growthPerPeriod().deadlineMisses;
+            stats.extrapolatedTicks = skipped;
+
+            // Queued deadlines move with the front ones, an overloaded backlog's tail is never reached before the horizon
+            for (size_t i = 0; i < threads.count(); ++i) {
+                nextReleaseTimes[i] += skipped;
+                for (size_t queued = taskDeadlines[i].size(); queued > 0; --queued) {
+                    taskDeadlines[i].push(*taskDeadlines[i].top() + deadlineShift);
+                    taskDeadlines[i].pop();
+                }
+            }
+            DaryHeap<ReadyThread> shifted;
+            for (; !readyThreads.isEmpty(); readyThreads.pop()) {
+                shifted.push({readyThreads.top().deadline + deadlineShift, readyThreads.top().threadIndex});
+            }
+            readyThreads = shifted;
+
+            timeCounter += skipped;
+            steadyState.stop();
+            continue;
+        }
+
+        // Add tasks based on release times and find the next release, only when one is due
+        if (timeCounter >= nextRelease) {
+            nextRelease = horizon;
+            for (size_t i = 0; i < threads.count(); ++i) {
+                if (timeCounter >= nextReleaseTimes[i]) {
+                    nextReleaseTimes[i] += threads.frequencies[i];
+                    addTask(i, timeCounter, nextReleaseTimes[i]);
+                    stats.tasksCreated++;
+                }
+                nextRelease = min(nextRelease, nextReleaseTimes[i]);
+            }
+        }
+
+        // Nothing changes until the next release, unless the running task finishes first
+        long long step = nextRelease - timeCounter;
+        int runningThreadIndex = earliestDeadlineThread();
+        if (runningThreadIndex != -1) {
+            size_t threadIndex = static_cast<size_t>(runningThreadIndex);
+            Task* runningTask = threads.taskQueues[threadIndex].top();
+            step = min(step, static_cast<long long>(runningTask->getRequested() - runningTask->getServiced()));
+
+            runningTask->setServiced(runningTask->getServiced() + static_cast<int>(step));
+            if (runningTask->getServiced() == runningTask->getRequested()) {
+                if (removeTopTask(threadIndex, timeCounter + step)) {
+                    stats.deadlineMisses++;
+                }
+                stats.tasksServiced++;
+            }
+        }
+
+        timeCounter += step;
+    }
+
+    // Tasks still queued past their deadline missed it too, however long they had left
+    stats.deadlineMisses += stats.tasksCreated - stats.tasksServiced - queuedNotYetDue(taskDeadlines, horizon);
+    stats.tasksDue = tasksDueWithin(threads.frequencies, firstReleases, horizon);
+    return stats;
+}
+
+// Queue a task for a thread, a thread that was idle joins the heap
+void EDFScheduler::addTask(size_t threadIndex, long long releaseTick, long long deadline) {
+    if (threads.taskQueues[threadIndex].isEmpty()) {
+        readyThreads.push({deadline, threadIndex});
+    }
+    threads.taskQueues[threadIndex].push(Task(threads.sizes[threadIndex], releaseTick));
+    taskDeadlines[threadIndex].push(deadline);
+}
+
+// Finish the running thread's front task, it is always the top of the heap
+bool EDFScheduler::removeTopTask(size_t threadIndex, long long finishTime) {
+    bool missed = finishTime > *taskDeadlines[threadIndex].top();
+    threads.taskQueues[threadIndex].pop();
+    taskDeadlines[threadIndex].pop();
+
+    if (threads.taskQueues[threadIndex].isEmpty()) {
+        readyThreads.pop();
+    } else {
+        readyThreads.replaceTop({*taskDeadlines[threadIndex].top(), threadIndex});
+    }
+    return missed;
+}
+
+// Fill in the deadline of each thread's front task, 0 for an empty queue
+const vector<long long>& EDFScheduler::queuedFrontDeadlines(vector<long long>& frontDeadlines) {
+    for (size_t i = 0; i < threads.count(); ++i) {
+        frontDeadlines[i] = taskDeadlines[i].isEmpty() ? 0 : *taskDeadlines[i].top();
+    }
+    return frontDeadlines;
+}
+
+// Index of the thread whose front task is due first, or -1 if every queue is empty
+int EDFScheduler::earliestDeadlineThread() {
+    if (readyThreads.isEmpty()) {
+        return -1;
+    }
+    return static_cast<int>(readyThreads.top().threadIndex);
+}
@@ -0,0 +1,75 @@
+/**
+ * @file EarliestDeadlineFirst.h
+ * @brief Contains the earliest deadline first class definitions
+ *
+ * Contains the definition of the earliest deadline first scheduler.
+ * Threads release like the rate monotonic scheduler, and every task must
+ * finish before its thread releases the next one. The ready threads sit in
+ * a 4-ary heap keyed by their front task's deadline, so each dispatch is
+ * O(log n) however many threads there are.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "DaryHeap.h"
+#include "LatencyHistogram.h"
+#include "OutputLevel.h"
+#include "RingQueue.h"
+#include "SchedulerCommon.h"
+#include "Task.h"
+#include "TickEngine.h"
+#include <vector>
+#include <iostream>
+using namespace std;
+
+class EDFScheduler {
+    protected:
+        // Heap entry for a thread with tasks, earliest deadline first and ties to the lowest index
+        struct ReadyThread {
+            long long deadline;
+            size_t threadIndex;
+            bool operator<(const ReadyThread& other) const {
+                return deadline < other.deadline || (deadline == other.deadline && threadIndex < other.threadIndex);
+            }
+        };
+
+        ThreadTable threads;                 // Stores each thread's queue, size, and frequency
+        vector<long long> nextReleaseTimes;  // Tracks the next release time for each thread
+        vector<RingQueue<long long>> taskDeadlines;  // Deadline of each queued task, in queue order
+        DaryHeap<ReadyThread> readyThreads;  // One entry per thread with tasks
+
+        void addTask(size_t threadIndex, long long releaseTick, long long deadline);
+        bool removeTopTask(size_t threadIndex, long long finishTime);  // Returns true if the task missed its deadline
+        int earliestDeadlineThread();
+        const vector<long long>& queuedFrontDeadlines(vector<long long>& frontDeadlines);
+
+        long long tickMisses = 0;             // Deadline misses of the current tick by tick run
+        vector<ThreadLatency> tickLatencies;  // Latencies of the current tick by tick run
+        void recordUnfinished(long long horizon);  // Add the tasks still queued at the horizon to tickLatencies
+
+        // Tick engine hooks, see TickEngine.h
+        int releaseTick(size_t threadIndex, long long time);
+        size_t releaseQueue(size_t threadIndex);
+        TickSelection selectTick();
+        TickCell tickCell(size_t threadIndex, TickSelection selection, bool created);
+        bool serviceTick(TickSelection selection, long long time);
+
+        template <typename Policy, typename Renderer>
+        friend TickTotals runTickEngine(Policy& policy, Renderer& renderer, size_t threadCount, long long horizon,
+                                        TraceWriter* trace, const SwitchCosts& costs);
+    public:
+        // Constructors and Destructor
+        EDFScheduler(ExampleType exampleType);
+        EDFScheduler(const vector<Thread>& threadSet);
+        ~EDFScheduler();
+
+        static vector<Thread> exampleThreadSet(ExampleType exampleType);  // The rate monotonic examples
+
+        // Functions to run the examples
+        void runExample();
+        void run(long long horizon, OutputLevel output);  // Timeline runs go tick by tick, otherwise event-driven
+        void runTicks(long long horizon, OutputLevel output);  // Tick by tick run, with the status display at timeline output
+        SimulationStats simulate(long long horizon);      // Event-driven run with no display
+};
@@ -0,0 +1,66 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief Latency histogram implementation.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "LatencyHistogram.h"
+#include <algorithm>  // For min, max
+#include <cmath>      // For ceil
+#include <iostream>
+
+LatencyHistogram::LatencyHistogram(long long largestValue)
+    : counts(bucketIndex(std::max(largestValue, 0LL)) + 1, 0), total(0), valueSum(0),
+      clampValue(std::max(largestValue, 0LL)), largest(0) {}
+
+long long LatencyHistogram::bucketTop(size_t index) {
+    long long bucket = static_cast<long long>(index);
+    if (bucket < 2 * subBucketCount) {
+        return bucket;
+    }
+    long long shift = bucket / subBucketCount - 1;
+    long long subBucket = bucket % subBucketCount + subBucketCount;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+long long LatencyHistogram::count() const {
+    return total;
+}
+
+long long LatencyHistogram::sum() const {
+    return valueSum;
+}
+
+long long LatencyHistogram::max() const {
+    return largest;
+}
+
+long long LatencyHistogram::percentile(double fraction) const {
+    if (total == 0) {
+        return 0;
+    }
+    long long rank = std::max(1LL, static_cast<long long>(std::ceil(fraction * static_cast<double>(total))));
+    long long seen = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return std::min(bucketTop(i), largest);
+        }
+    }
+    return largest;
+}
+
+void printLatencyReport(const std::vector<ThreadLatency>& latencies) {
+    std::cout << "thread finished queued response p50/p99/max waiting p50/p99/max missed lateness p50/p99/max" << std::endl;
+    for (size_t i = 0; i < latencies.size(); ++i) {
+        const ThreadLatency& latency = latencies[i];
+        std::cout << i + 1 << " " << latency.response.count() << " " << latency.queued << " "
+                  << latency.response.percentile(0.5) << "/" << latency.response.percentile(0.99) << "/"
+                  << latency.response.max() << " "
+                  << latency.waiting.percentile(0.5) << "/" << latency.waiting.percentile(0.99) << "/"
+                  << latency.waiting.max() << " " << latency.lateness.count() << " " << latency.lateness.percentile(0.5)
+                  << "/" << latency.lateness.percentile(0.99) << "/" << latency.lateness.max() << std::endl;
+    }
+}
@@ -0,0 +1,101 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief Contains the latency histogram class and the per thread latency record
+ *
+ * Log bucketed histogram in the style of HdrHistogram. Values below 16 get a
+ * bucket each, above that every power of two is split into 8 buckets, so a
+ * percentile is never more than 12.5% above the true value. The buckets are
+ * sized once for the largest value a run can produce and never grow.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "Task.h"
+#include <algorithm>  // For min, max
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+class LatencyHistogram {
+private:
+    static const int subBucketBits = 3;
+    static const long long subBucketCount = 1LL << subBucketBits;
+
+    std::vector<long long> counts;
+    long long total;
+    long long valueSum;    // Sum of the recorded values, for the mean
+    long long clampValue;  // Largest value with a bucket
+    long long largest;     // Largest value recorded
+
+    // Values below twice the sub bucket count map to themselves, above that by exponent and top bits
+    static size_t bucketIndex(long long value) {
+        if (value < 2 * subBucketCount) {
+            return static_cast<size_t>(value);
+        }
+#ifdef _MSC_VER
+        unsigned long highestBit;
+        _BitScanReverse64(&highestBit, static_cast<uint64_t>(value));
+        int shift = static_cast<int>(highestBit) - subBucketBits;
+#else
+        int shift = 63 - __builtin_clzll(static_cast<uint64_t>(value)) - subBucketBits;
+#endif
+        return static_cast<size_t>((shift + 1) * subBucketCount + ((value >> shift) - subBucketCount));
+    }
+
+    static long long bucketTop(size_t index);  // Largest value that lands in the bucket
+public:
+    // Constructor, values above largestValue are counted as largestValue
+    explicit LatencyHistogram(long long largestValue = 0);
+
+    // Inline, the tick loops record every finished task
+    void record(long long value) {
+        value = std::min(std::max(value, 0LL), clampValue);
+        counts[bucketIndex(value)]++;
+        total++;
+        valueSum += value;
+        largest = std::max(largest, value);
+    }
+
+    long long count() const;
+    long long sum() const;
+    long long max() const;
+
+    // fraction 0.5 is the median, rounded up to the top of its bucket but never past max(), 0 if nothing was recorded
+    long long percentile(double fraction) const;
+};
+
+// Timing of a thread's finished tasks, in ticks, and of the ones still queued at the end of the run
+struct ThreadLatency {
+    LatencyHistogram response;  // Release to completion
+    LatencyHistogram waiting;   // Release to first run
+    LatencyHistogram lateness;  // Completion past the deadline, only for missed deadlines, or the horizon past it if unfinished
+    long long queued = 0;       // Tasks still queued at the horizon
+
+    explicit ThreadLatency(long long horizon = 0) : response(horizon), waiting(horizon), lateness(horizon) {}
+
+    // Record a finished task, its deadline is when its thread next released
+    void record(Task& task, long long deadline) {
+        response.record(task.getCompletionTick() - task.getReleaseTick());
+        waiting.record(task.getFirstRunTick() - task.getReleaseTick());
+        if (task.getCompletionTick() > deadline) {
+            lateness.record(task.getCompletionTick() - deadline);
+        }
+    }
+
+    // Record a task still queued at the horizon, it already missed its deadline if that was at or before the horizon
+    void recordUnfinished(long long deadline, long long horizon) {
+        queued++;
+        if (deadline <= horizon) {
+            lateness.record(horizon - deadline);
+        }
+    }
+};
+
+// Per thread p50, p99 and max of each histogram, missed and lateness include the overdue queued tasks
+void printLatencyReport(const std::vector<ThreadLatency>& latencies);
@@ -0,0 +1,97 @@
+/**
+ * @file MpmcQueue.h
+ * @brief Contains the bounded lock-free queue class template
+ *
+ * Fixed capacity FIFO that any number of threads can push to and pop from
+ * without locks. Every slot carries a sequence number that says whether it
+ * is ready to be written or read on the current lap, so producers and
+ * consumers only contend on their own position counter.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+template <typename T>
+class MpmcQueue {
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        T item;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask;  // Capacity - 1, the capacity is a power of two
+    alignas(64) std::atomic<std::size_t> pushPosition;
+    alignas(64) std::atomic<std::size_t> popPosition;
+
+public:
+    // Capacity is rounded up to a power of two
+    explicit MpmcQueue(std::size_t capacity) : pushPosition(0), popPosition(0) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        slots.reset(new Slot[size]);
+        mask = size - 1;
+        for (std::size_t i = 0; i < size; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    // Returns false if the queue is full
+    bool tryPush(const T& item) {
+        std::size_t position = pushPosition.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[position & mask];
+            std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t lap = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (lap == 0) {
+                if (pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.item = item;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lap < 0) {
+                return false;
+            } else {
+                position = pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Returns false if the queue is empty
+    bool tryPop(T& item) {
+        std::size_t position = popPosition.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[position & mask];
+            std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t lap = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (lap == 0) {
+                if (popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    item = slot.item;
+                    slot.sequence.store(position + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lap < 0) {
+                return false;
+            } else {
+                position = popPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Snapshot only, other threads may change it at any moment
+    bool isEmpty() const {
+        return pushPosition.load(std::memory_order_acquire) == popPosition.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const { return mask + 1; }
+};
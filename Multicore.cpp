@@ -0,0 +1,326 @@
+/**
+ * @file Multicore.cpp
+ * @brief Multicore scheduler implementation.
+ *
+ * Simulates several CPUs, each picking from its own threads every tick.
+ * Under global placement idle CPUs steal waiting threads from busy ones.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "Multicore.h"
+#include "ASCII.h"  // For coloring
+#include "AsyncTimelineRenderer.h"
+#include <algorithm>  // For lower_bound, upper_bound, max, sort, stable_sort
+
+using namespace std;
+
+// Constructor loads the thread set and bin packs it onto the CPUs
+MulticoreScheduler::MulticoreScheduler(const vector<Thread>& threadSet, CorePolicy corePolicy, CorePlacement corePlacement,
+                                       size_t cpuCount)
+    : cores(max<size_t>(cpuCount, 1)), policy(corePolicy), placement(corePlacement) {
+    threads.assign(threadSet);
+    taskDeadlines.resize(threads.count());
+    lastCpu.assign(threads.count(), -1);
+
+    // Rate monotonic first releases at one period, round robin at time zero
+    for (int frequency : threads.frequencies) {
+        nextReleaseTimes.push_back(policy == CorePolicy::RATE_MONOTONIC ? frequency : 0);
+    }
+    assignThreads();
+}
+
+// Destructor to clear the queues in each thread
+MulticoreScheduler::~MulticoreScheduler() {
+    for (TaskQueue& taskQueue : threads.taskQueues) {
+        while (!taskQueue.isEmpty()) {
+            taskQueue.pop();
+        }
+    }
+}
+
+// First fit decreasing by utilization, a thread that fits nowhere goes to the least loaded CPU
+void MulticoreScheduler::assignThreads() {
+    vector<size_t> order(threads.count());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    auto utilization = [this](size_t i) { return static_cast<double>(threads.sizes[i]) / threads.frequencies[i]; };
+    stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return utilization(a) > utilization(b); });
+
+    threadCpu.assign(threads.count(), 0);
+    for (size_t threadIndex : order) {
+        double load = utilization(threadIndex);
+        size_t target = 0;
+        bool fits = false;
+        for (size_t cpu = 0; cpu < cores.size() && !fits; ++cpu) {
+            if (cores[cpu].load + load <= 1.0 + 1e-9) {
+                target = cpu;
+                fits = true;
+            } else if (cores[cpu].load < cores[target].load) {
+                target = cpu;
+            }
+        }
+        cores[target].threadList.push_back(threadIndex);
+        cores[target].load += load;
+        threadCpu[threadIndex] = target;
+    }
+
+    for (Core& core : cores) {
+        sort(core.threadList.begin(), core.threadList.end());
+        core.cursor = core.threadList.empty() ? 0 : core.threadList.front();
+    }
+}
+
+// Change how many ticks a round robin thread may run before it is preempted
+void MulticoreScheduler::setTimeQuantum(int quantum) {
+    timeQuantum = max(quantum, 1);
+}
+
+size_t MulticoreScheduler::cpuCount() const {
+    return cores.size();
+}
+
+// Run for any horizon, then print the totals and each CPU's share
+void MulticoreScheduler::run(long long horizon, OutputLevel output) {
+    MulticoreStats stats = runTicks(horizon, output);
+    if (output == OutputLevel::NONE) {
+        return;
+    }
+
+    cout << "Total tasks created: " << stats.totals.tasksCreated << endl;
+    cout << "Total tasks serviced: " << stats.totals.tasksServiced << endl;
+    if (policy == CorePolicy::RATE_MONOTONIC) {
+        cout << "Deadline misses: " << stats.totals.deadlineMisses << endl;
+    }
+    for (size_t cpu = 0; cpu < cores.size(); ++cpu) {
+        double utilization = horizon > 0 ? 100.0 * stats.busyTicks[cpu] / horizon : 0.0;
+        cout << "CPU " << cpu << ": " << stats.threadsOnCpu[cpu] << " threads, busy " << stats.busyTicks[cpu] << " of "
+             << horizon << " ticks (" << utilization << "%), " << stats.steals[cpu] << " steals" << endl;
+    }
+    cout << "Task migrations: " << stats.migrations << endl;
+}
+
+// Main scheduler loop, every CPU runs at most one task each tick
+MulticoreStats MulticoreScheduler::runTicks(long long horizon, OutputLevel output) {
+    const int frameBoundary = 24;
+    const bool display = (output == OutputLevel::TIMELINE);
+    AsyncTimelineRenderer renderer;  // Draws on its own thread, so a slow terminal doesn't hold up the run
+
+    MulticoreStats stats;
+    stats.totals = {0, 0, 0, 0, 0, 0, 0, 0};
+    stats.busyTicks.assign(cores.size(), 0);
+    stats.steals.assign(cores.size(), 0);
+    stats.migrations = 0;
+    vector<long long> firstReleases = nextReleaseTimes;
+
+    vector<bool> taskCreated(threads.count());
+    vector<bool> claimed(threads.count());
+    vector<int> running(cores.size());
+
+    long long timeCounter = 0;
+    while (timeCounter < horizon) {
+        if (display && timeCounter % frameBoundary == 0) {
+            renderer.newFrame();
+        }
+
+        // Add tasks based on release times
+        for (size_t i = 0; i < threads.count(); ++i) {
+            taskCreated[i] = releaseDue(i, timeCounter);
+            if (taskCreated[i]) {
+                addTask(i);
+                stats.totals.tasksCreated++;
+            }
+        }
+
+        // Every CPU picks from its own threads first
+        fill(claimed.begin(), claimed.end(), false);
+        for (size_t cpu = 0; cpu < cores.size(); ++cpu) {
+            running[cpu] = pickThread(cpu, claimed);
+            if (running[cpu] != -1) {
+                claimed[running[cpu]] = true;
+                cores[cpu].cursor = static_cast<size_t>(running[cpu]);
+            }
+        }
+
+        // Then idle CPUs take waiting threads from the busiest ones
+        for (size_t cpu = 0; placement == CorePlacement::GLOBAL && cpu < cores.size(); ++cpu) {
+            if (running[cpu] == -1) {
+                running[cpu] = stealThread(cpu, claimed);
+                if (running[cpu] != -1) {
+                    claimed[running[cpu]] = true;
+                    stats.steals[cpu]++;
+                }
+            }
+        }
+
+        // Display thread statuses, one column group per CPU
+        for (size_t cpu = 0; display && cpu < cores.size(); ++cpu) {
+            if (cpu > 0) {
+                renderer.write(" ");
+            }
+            for (size_t i = 0; i < threads.count(); ++i) {
+                if (running[cpu] == static_cast<int>(i)) {
+                    // Turquoise if a task is both created and executed in this time unit, green if only executed
+                    renderer.writeCell(taskCreated[i] ? COLOR_TURQUOISE : COLOR_GREEN, "█▓▒░");
+                } else if (threadCpu[i] != cpu) {
+                    // Blank if the thread is queued on another CPU
+                    renderer.write("    ");
+                } else if (taskCreated[i]) {
+                    // Yellow if a task is created but not running
+                    renderer.writeCell(COLOR_YELLOW, "█▓▒░");
+                } else if (!threads.taskQueues[i].isEmpty()) {
+                    // Red if the thread has tasks waiting
+                    renderer.writeCell(COLOR_RED, "█▓▒░");
+                } else {
+                    // Gray if no tasks are in the queue
+                    renderer.writeCell(COLOR_GRAY, "░░░░");
+                }
+            }
+        }
+        if (display) {
+            renderer.endRow(timeCounter + 1);
+        }
+
+        // Run one tick of each picked task
+        for (size_t cpu = 0; cpu < cores.size(); ++cpu) {
+            Core& core = cores[cpu];
+            if (running[cpu] == -1) {
+                // Nothing to run, the idle round robin selection advances one thread per tick
+                if (policy == CorePolicy::ROUND_ROBIN && !core.threadList.empty()) {
+                    core.cursor = nextInList(core, core.cursor);
+                }
+                continue;
+            }
+
+            size_t threadIndex = static_cast<size_t>(running[cpu]);
+            stats.busyTicks[cpu]++;
+            if (lastCpu[threadIndex] != -1 && lastCpu[threadIndex] != static_cast<int>(cpu)) {
+                stats.migrations++;
+            }
+            lastCpu[threadIndex] = static_cast<int>(cpu);
+
+            TaskQueue& taskQueue = threads.taskQueues[threadIndex];
+            Task* runningTask = taskQueue.top();
+            runningTask->setServiced(runningTask->getServiced() + 1);
+            bool completed = runningTask->getServiced() == runningTask->getRequested();
+            if (completed) {
+                if (policy == CorePolicy::RATE_MONOTONIC) {
+                    if (timeCounter + 1 > *taskDeadlines[threadIndex].top()) {
+                        stats.totals.deadlineMisses++;
+                    }
+                    taskDeadlines[threadIndex].pop();
+                }
+                taskQueue.pop();
+                stats.totals.tasksServiced++;
+                lastCpu[threadIndex] = -1;
+            }
+
+            if (policy == CorePolicy::ROUND_ROBIN) {
+                core.quantumUsed++;
+                if (completed || core.quantumUsed >= timeQuantum) {
+                    core.cursor = nextInList(core, threadIndex);
+                    core.quantumUsed = 0;
+                }
+            }
+        }
+
+        timeCounter++;
+    }
+
+    renderer.flush();
+    if (policy == CorePolicy::RATE_MONOTONIC) {
+        // Tasks still queued past their deadline missed it too
+        long long backlog = stats.totals.tasksCreated - stats.totals.tasksServiced;
+        stats.totals.deadlineMisses += backlog - queuedNotYetDue(taskDeadlines, horizon);
+        stats.totals.tasksDue = tasksDueWithin(threads.frequencies, firstReleases, horizon);
+    }
+    for (const Core& core : cores) {
+        stats.threadsOnCpu.push_back(core.threadList.size());
+    }
+    return stats;
+}
+
+// True when the thread's next task is due
+bool MulticoreScheduler::releaseDue(size_t threadIndex, long long time) const {
+    return time >= nextReleaseTimes[threadIndex];
+}
+
+// Queue a task for a thread, due by its next release
+void MulticoreScheduler::addTask(size_t threadIndex) {
+    nextReleaseTimes[threadIndex] += threads.frequencies[threadIndex];
+    threads.taskQueues[threadIndex].push(Task(threads.sizes[threadIndex]));
+    if (policy == CorePolicy::RATE_MONOTONIC) {
+        taskDeadlines[threadIndex].push(nextReleaseTimes[threadIndex]);
+    }
+}
+
+// Highest priority waiting thread for rate monotonic, the next one from the cursor for round robin
+int MulticoreScheduler::pickThread(size_t cpu, const vector<bool>& claimed) const {
+    const Core& core = cores[cpu];
+    if (policy == CorePolicy::RATE_MONOTONIC) {
+        int best = -1;
+        for (size_t threadIndex : core.threadList) {
+            if (!claimed[threadIndex] && !threads.taskQueues[threadIndex].isEmpty() &&
+                (best == -1 || threads.priorities[threadIndex] < threads.priorities[best])) {
+                best = static_cast<int>(threadIndex);
+            }
+        }
+        return best;
+    }
+
+    size_t count = core.threadList.size();
+    size_t start = static_cast<size_t>(lower_bound(core.threadList.begin(), core.threadList.end(), core.cursor) -
+                                       core.threadList.begin());
+    for (size_t checked = 0; checked < count; ++checked) {
+        size_t threadIndex = core.threadList[(start + checked) % count];
+        if (!claimed[threadIndex] && !threads.taskQueues[threadIndex].isEmpty()) {
+            return static_cast<int>(threadIndex);
+        }
+    }
+    return -1;
+}
+
+// Take the thread the CPU with the most waiting tasks would run next
+int MulticoreScheduler::stealThread(size_t cpu, const vector<bool>& claimed) {
+    size_t victim = cpu;
+    long long mostWaiting = 0;
+    for (size_t other = 0; other < cores.size(); ++other) {
+        long long waiting = 0;
+        for (size_t threadIndex : cores[other].threadList) {
+            if (!claimed[threadIndex]) {
+                waiting += static_cast<long long>(threads.taskQueues[threadIndex].size());
+            }
+        }
+        if (other != cpu && waiting > mostWaiting) {
+            victim = other;
+            mostWaiting = waiting;
+        }
+    }
+    if (victim == cpu) {
+        return -1;
+    }
+
+    int threadIndex = pickThread(victim, claimed);
+    moveThread(static_cast<size_t>(threadIndex), cpu);
+    cores[cpu].cursor = static_cast<size_t>(threadIndex);
+    cores[cpu].quantumUsed = 0;
+    return threadIndex;
+}
+
+// The thread after threadIndex on the CPU, wrapping around to the first
+size_t MulticoreScheduler::nextInList(const Core& core, size_t threadIndex) const {
+    auto next = upper_bound(core.threadList.begin(), core.threadList.end(), threadIndex);
+    return next == core.threadList.end() ? core.threadList.front() : *next;
+}
+
+// Requeue a thread on another CPU, keeping both lists in thread index order
+void MulticoreScheduler::moveThread(size_t threadIndex, size_t cpu) {
+    vector<size_t>& from = cores[threadCpu[threadIndex]].threadList;
+    from.erase(lower_bound(from.begin(), from.end(), threadIndex));
+
+    vector<size_t>& to = cores[cpu].threadList;
+    to.insert(lower_bound(to.begin(), to.end(), threadIndex), threadIndex);
+    threadCpu[threadIndex] = cpu;
+}
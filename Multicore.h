@@ -0,0 +1,77 @@
+/**
+ * @file Multicore.h
+ * @brief Contains the multicore scheduler class definition
+ *
+ * Runs a thread set on several simulated CPUs, each running one task per
+ * tick with rate monotonic or round robin selection over its own threads.
+ * Threads are bin packed onto CPUs by utilization, first fit decreasing.
+ *
+ * Partitioned placement keeps every thread on its CPU. Global placement lets
+ * a CPU with nothing to run steal a waiting thread from the CPU with the most
+ * waiting tasks, and the thread stays on the thief until it is stolen again.
+ * A thread's tasks still run one at a time, so it is on at most one CPU.
+ * Threads sharing a priority keep separate queues here, unlike the single CPU
+ * rate monotonic scheduler.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "OutputLevel.h"
+#include "RingQueue.h"
+#include "SchedulerCommon.h"
+#include "Task.h"
+#include <vector>
+#include <iostream>
+using namespace std;
+
+enum class CorePlacement { PARTITIONED, GLOBAL };
+
+// Totals for a multicore run, with the per CPU counters
+struct MulticoreStats {
+    SimulationStats totals;
+    vector<long long> busyTicks;      // Ticks each CPU spent running a task
+    vector<long long> steals;         // Threads each CPU took from another CPU's queues
+    vector<size_t> threadsOnCpu;      // Threads queued on each CPU at the end of the run
+    long long migrations;             // Started tasks that resumed on a different CPU
+};
+
+class MulticoreScheduler {
+    protected:
+        // One simulated CPU, threadList is kept in thread index order
+        struct Core {
+            vector<size_t> threadList;
+            size_t cursor = 0;    // Round robin's current thread index
+            int quantumUsed = 0;  // Ticks the current round robin thread has run
+            double load = 0.0;    // Utilization of the threads bin packed onto it
+        };
+
+        ThreadTable threads;                 // Stores each thread's queue, priority, size, and frequency
+        vector<long long> nextReleaseTimes;  // Tracks the next release time for each thread
+        vector<RingQueue<long long>> taskDeadlines;  // Deadline of each queued task, rate monotonic only
+        vector<size_t> threadCpu;            // CPU each thread is queued on
+        vector<int> lastCpu;                 // CPU the thread's front task last ran on, -1 before it starts
+        vector<Core> cores;
+        CorePolicy policy;
+        CorePlacement placement;
+        int timeQuantum = 4;
+
+        void assignThreads();
+        bool releaseDue(size_t threadIndex, long long time) const;
+        void addTask(size_t threadIndex);
+        int pickThread(size_t cpu, const vector<bool>& claimed) const;  // -1 if nothing on the CPU can run
+        int stealThread(size_t cpu, const vector<bool>& claimed);       // Moves the thread over, -1 if none waits
+        size_t nextInList(const Core& core, size_t threadIndex) const;  // Round robin's next thread after threadIndex
+        void moveThread(size_t threadIndex, size_t cpu);
+    public:
+        // Constructor and Destructor
+        MulticoreScheduler(const vector<Thread>& threadSet, CorePolicy corePolicy, CorePlacement corePlacement,
+                           size_t cpuCount);
+        ~MulticoreScheduler();
+
+        void run(long long horizon, OutputLevel output);  // Prints the per CPU summary after the run
+        MulticoreStats runTicks(long long horizon, OutputLevel output);  // Tick by tick run, one column group per CPU at timeline output
+        void setTimeQuantum(int quantum);  // Round robin ticks per turn, at least 1
+        size_t cpuCount() const;
+};
@@ -0,0 +1,261 @@
+/**
+ * @file MultilevelFeedbackQueue.cpp
+ * @brief Multilevel feedback queue scheduler implementation.
+ *
+ * Example of a scheduler that learns how long tasks run from how they
+ * used their last quantum, favoring the short ones without knowing sizes
+ * in advance.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "MultilevelFeedbackQueue.h"
+#include "ASCII.h"  // For coloring
+#include "RoundRobin.h"
+#include "AsyncTimelineRenderer.h"
+#include <algorithm>  // For max, min
+#include <limits>     // For numeric_limits
+
+using namespace std;
+
+// Same thread tables as the round robin examples, so the two can be compared directly
+vector<Thread> MLFQScheduler::exampleThreadSet(ExampleType exampleType) {
+    return RoundRobinScheduler::exampleThreadSet(exampleType);
+}
+
+// Constructor initializes threads and the levels based on example type
+MLFQScheduler::MLFQScheduler(ExampleType exampleType) : MLFQScheduler(exampleThreadSet(exampleType)) {}
+
+// Constructor initializes threads and the levels from a loaded thread set
+MLFQScheduler::MLFQScheduler(const vector<Thread>& threadSet) {
+    threads.assign(threadSet);
+    queuedTasks.assign(threads.count(), 0);
+    resetLevels(3);
+}
+
+// Quanta double in a wider type and stop at the largest int, a large top quantum would overflow by the last level
+void MLFQScheduler::resetLevels(size_t levelCount) {
+    levels.clear();
+    levels.resize(levelCount);
+    for (size_t level = 0; level < levelCount; ++level) {
+        long long quantum = static_cast<long long>(baseQuantum) << level;
+        levels[level].quantum = static_cast<int>(min(quantum, static_cast<long long>(numeric_limits<int>::max())));
+        levels[level].headUsed = 0;
+    }
+    readyLevels.resize(levelCount);
+    queuedTasks.assign(threads.count(), 0);
+}
+
+// Example run with the scrolling thread status display
+void MLFQScheduler::runExample() {
+    runTicks(10008, OutputLevel::TIMELINE);
+}
+
+void MLFQScheduler::run(long long horizon, OutputLevel output) {
+    runTicks(horizon, output);
+}
+
+// Take releases from an arrival source in later runs
+void MLFQScheduler::setArrivals(ArrivalSource* source) {
+    arrivals = source;
+}
+
+// Change the number of levels and the top level's quantum for later runs
+void MLFQScheduler::setLevels(int levelCount, int quantum) {
+    baseQuantum = max(quantum, 1);
+    resetLevels(static_cast<size_t>(min(max(levelCount, 1), maxLevels)));
+}
+
+void MLFQScheduler::setBoostPeriod(long long period) {
+    boostPeriod = max(period, 0LL);
+}
+
+const vector<ThreadLatency>& MLFQScheduler::latencies() const {
+    return tickLatencies;
+}
+
+void MLFQScheduler::queueTask(size_t level, const Task& task, size_t threadIndex) {
+    levels[level].tasks.push(task);
+    levels[level].owners.push(threadIndex);
+    readyLevels.set(level);
+}
+
+void MLFQScheduler::popTask(size_t level) {
+    FeedbackLevel& feedbackLevel = levels[level];
+    feedbackLevel.tasks.pop();
+    feedbackLevel.owners.pop();
+    feedbackLevel.headUsed = 0;
+    if (feedbackLevel.tasks.isEmpty()) {
+        readyLevels.clear(level);
+    }
+}
+
+// Lower levels keep their order behind the top level's tasks, and every task starts a fresh quantum
+void MLFQScheduler::boost() {
+    bool moved = false;
+    for (size_t level = 1; level < levels.size(); ++level) {
+        while (!levels[level].tasks.isEmpty()) {
+            queueTask(0, *levels[level].tasks.top(), *levels[level].owners.top());
+            popTask(level);
+            moved = true;
+        }
+    }
+    levels[0].headUsed = 0;
+    if (moved) {
+        tickBoosts++;
+    }
+}
+
+// Release a task for the thread at every multiple of its frequency, new tasks start at the top
+int MLFQScheduler::releaseTick(size_t threadIndex, long long time) {
+    if (threadIndex == 0) {
+        releases.advance();
+    }
+    if (!releases.isReleased(threadIndex)) {
+        return 0;
+    }
+    queueTask(0, Task(threads.sizes[threadIndex], time), threadIndex);
+    queuedTasks[threadIndex]++;
+    return 1;
+}
+
+// Release the thread's arrivals from the source instead
+int MLFQScheduler::releaseArrivals(size_t threadIndex, long long time) {
+    if (threadIndex == 0) {
+        arrivalBatch.collect(*arrivals, time, threads.count());
+    }
+    int released = 0;
+    Arrival arrival;
+    while (arrivalBatch.next(threadIndex, arrival)) {
+        queueTask(0, Task(arrival.size, time), threadIndex);
+        released++;
+    }
+    queuedTasks[threadIndex] += released;
+    return released;
+}
+
+// Tasks share the levels, the thread index stands in for the queue
+size_t MLFQScheduler::releaseQueue(size_t threadIndex) {
+    return threadIndex;
+}
+
+// Front task of the highest level with tasks
+TickSelection MLFQScheduler::selectTick() {
+    size_t level = readyLevels.findFirst();
+    if (level == ReadyBitmap::npos) {
+        return {-1, false};
+    }
+    selectedLevel = level;
+    return {static_cast<int>(*levels[level].owners.top()), true};
+}
+
+TickCell MLFQScheduler::tickCell(size_t threadIndex, TickSelection selection, bool created) {
+    bool isRunning = selection.hasTask && static_cast<int>(threadIndex) == selection.thread;
+    bool hasTask = queuedTasks[threadIndex] > 0;
+
+    if (isRunning && created) {
+        // Turquoise if a task is both created and executed in this time unit
+        return {&COLOR_TURQUOISE, "█▓▒░"};
+    } else if (isRunning) {
+        // Green if this thread is currently running a task
+        return {&COLOR_GREEN, "█▓▒░"};
+    } else if (created) {
+        // Yellow if a task is created but not running
+        return {&COLOR_YELLOW, "█▓▒░"};
+    } else if (hasTask) {
+        // Red for other threads with tasks waiting but not running
+        return {&COLOR_RED, "█▓▒░"};
+    }
+    // Gray if the thread has no tasks waiting
+    return {&COLOR_GRAY, "░░░░"};
+}
+
+// Service the selected task for one tick, dropping it a level once its quantum is used up
+bool MLFQScheduler::serviceTick(TickSelection selection, long long time) {
+    bool completed = false;
+    if (selection.hasTask) {
+        FeedbackLevel& current = levels[selectedLevel];
+        Task* currentTask = current.tasks.top();
+        size_t owner = *current.owners.top();
+        if (currentTask->getFirstRunTick() < 0) {
+            currentTask->setFirstRunTick(time);
+        }
+        currentTask->setServiced(currentTask->getServiced() + 1);
+        current.headUsed++;
+
+        if (currentTask->getServiced() == currentTask->getRequested()) {
+            // Finished, it was due when its thread next released
+            currentTask->setCompletionTick(time + 1);
+            tickLatencies[owner].record(*currentTask, currentTask->getReleaseTick() + threads.frequencies[owner]);
+            popTask(selectedLevel);
+            queuedTasks[owner]--;
+            completed = true;
+        } else if (current.headUsed >= current.quantum) {
+            // Quantum used up, drop a level, the bottom level goes round robin instead
+            size_t nextLevel = min(selectedLevel + 1, levels.size() - 1);
+            Task demoted = *currentTask;
+            popTask(selectedLevel);
+            queueTask(nextLevel, demoted, owner);
+            if (nextLevel != selectedLevel) {
+                tickDemotions++;
+            }
+        }
+    }
+
+    if (boostPeriod > 0 && (time + 1) % boostPeriod == 0) {
+        boost();
+    }
+    return completed;
+}
+
+// Tasks still waiting in any level count against their owner, due when it next released after them
+void MLFQScheduler::recordUnfinished(long long horizon) {
+    for (FeedbackLevel& level : levels) {
+        for (size_t queued = level.tasks.size(); queued > 0; --queued) {
+            Task task = *level.tasks.top();
+            size_t owner = *level.owners.top();
+            level.tasks.pop();
+            level.owners.pop();
+            tickLatencies[owner].recordUnfinished(task.getReleaseTick() + threads.frequencies[owner], horizon);
+            level.tasks.push(task);
+            level.owners.push(owner);
+        }
+    }
+}
+
+// Main scheduler loop with scrolling thread status display
+TickTotals MLFQScheduler::runTicks(long long horizon, OutputLevel output) {
+    resetLevels(levels.size());
+    tickDemotions = 0;
+    tickBoosts = 0;
+    tickLatencies.assign(threads.count(), ThreadLatency(horizon));
+    releases.reset(threads.frequencies);
+
+    TickTotals totals;
+    ArrivalReleases<MLFQScheduler> replay(*this);
+    if (output == OutputLevel::TIMELINE) {
+        AsyncTimelineRenderer renderer;  // Draws on its own thread, so a slow terminal doesn't hold up the run
+        totals = (arrivals != nullptr) ? runTickEngine(replay, renderer, threads.count(), horizon, nullptr)
+                                       : runTickEngine(*this, renderer, threads.count(), horizon, nullptr);
+    } else {
+        NullRenderer renderer;
+        totals = (arrivals != nullptr) ? runTickEngine(replay, renderer, threads.count(), horizon, nullptr)
+                                       : runTickEngine(*this, renderer, threads.count(), horizon, nullptr);
+    }
+    recordUnfinished(horizon);
+
+    if (output != OutputLevel::NONE) {
+        cout << "Total tasks created: " << totals.tasksCreated << endl;
+        cout << "Total tasks serviced: " << totals.tasksServiced << endl;
+        cout << "Tasks dropped a level: " << tickDemotions << endl;
+        cout << "Priority boosts: " << tickBoosts << endl;
+        if (arrivals != nullptr && arrivalBatch.ignored() > 0) {
+            cout << "Arrivals for threads not in the set: " << arrivalBatch.ignored() << endl;
+        }
+    }
+    if (output == OutputLevel::TIMELINE || output == OutputLevel::LATENCY) {
+        printLatencyReport(tickLatencies);
+    }
+    return totals;
+}
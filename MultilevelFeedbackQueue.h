@@ -0,0 +1,95 @@
+/**
+ * @file MultilevelFeedbackQueue.h
+ * @brief Contains the multilevel feedback queue class definitions
+ *
+ * Threads release like the round robin scheduler, but their tasks wait by
+ * priority level instead of by thread. Every task starts at the top level,
+ * and a task that uses up its level's quantum without finishing drops a
+ * level, where the quantum is twice as long. Short tasks so finish near the
+ * top while long ones sink to the bottom, which runs round robin, and every
+ * boost period all tasks go back to the top so the sunken ones can't starve.
+ * The levels holding tasks are kept in a ReadyBitmap, so each dispatch is
+ * O(1) however many levels there are.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "ArrivalTrace.h"
+#include "LatencyHistogram.h"
+#include "OutputLevel.h"
+#include "ReadyBitmap.h"
+#include "ReleaseCountdown.h"
+#include "RingQueue.h"
+#include "SchedulerCommon.h"
+#include "Task.h"
+#include "TickEngine.h"
+#include <vector>
+#include <iostream>
+using namespace std;
+
+class MLFQScheduler {
+    protected:
+        // One priority level, owners holds the thread of each task in the same order as tasks
+        struct FeedbackLevel {
+            TaskQueue tasks;
+            RingQueue<size_t> owners;
+            int quantum;   // Ticks a task may run at this level before it drops a level
+            int headUsed;  // Ticks the front task has run at this level so far
+        };
+
+        ThreadTable threads;           // Stores each thread's size and frequency, tasks wait in the levels
+        vector<FeedbackLevel> levels;  // levels[0] runs first
+        ReadyBitmap readyLevels;       // One bit per level with tasks
+        vector<long long> queuedTasks; // Tasks of each thread waiting in any level
+        size_t selectedLevel = 0;      // Level of the task picked this tick
+
+        int baseQuantum = 2;           // Quantum of the top level, doubling on every level below
+        long long boostPeriod = 100;   // Ticks between moving every task back to the top, 0 never does
+        ArrivalSource* arrivals = nullptr;  // Replaces the periodic releases when set
+        ArrivalBatch arrivalBatch;          // Arrivals due this tick
+        ReleaseCountdown releases;          // Periodic releases of tick by tick runs, counted down for all threads at once
+
+        long long tickDemotions = 0;          // Tasks dropped a level in the current run
+        long long tickBoosts = 0;             // Boosts that moved at least one task in the current run
+        vector<ThreadLatency> tickLatencies;  // Latencies of the current run
+        void recordUnfinished(long long horizon);  // Add the tasks still queued at the horizon to tickLatencies
+
+        void resetLevels(size_t levelCount);  // Empty levels with quanta doubling from baseQuantum
+        void queueTask(size_t level, const Task& task, size_t threadIndex);
+        void popTask(size_t level);           // Remove the level's front task
+        void boost();                         // Move every task back to the top level
+
+        // Tick engine hooks, see TickEngine.h
+        int releaseTick(size_t threadIndex, long long time);
+        int releaseArrivals(size_t threadIndex, long long time);
+        size_t releaseQueue(size_t threadIndex);
+        TickSelection selectTick();
+        TickCell tickCell(size_t threadIndex, TickSelection selection, bool created);
+        bool serviceTick(TickSelection selection, long long time);
+
+        template <typename Policy, typename Renderer>
+        friend TickTotals runTickEngine(Policy& policy, Renderer& renderer, size_t threadCount, long long horizon,
+                                        TraceWriter* trace, const SwitchCosts& costs);
+        template <typename Policy>
+        friend class ArrivalReleases;
+    public:
+        static constexpr int maxLevels = 16;
+
+        // Constructors
+        MLFQScheduler(ExampleType exampleType);
+        MLFQScheduler(const vector<Thread>& threadSet);
+
+        static vector<Thread> exampleThreadSet(ExampleType exampleType);  // The round robin examples
+
+        // Functions to run the examples, every run goes tick by tick
+        void runExample();
+        void run(long long horizon, OutputLevel output);
+        TickTotals runTicks(long long horizon, OutputLevel output);  // Prints the totals unless output is NONE
+        void setArrivals(ArrivalSource* source);  // Release tasks from source instead of the frequencies, nullptr goes back
+        void setLevels(int levelCount, int quantum);  // 1 to maxLevels levels, the top one with quantum ticks
+        void setBoostPeriod(long long period);        // 0 turns boosting off
+
+        const vector<ThreadLatency>& latencies() const;  // Of the last run
+};
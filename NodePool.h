@@ -0,0 +1,91 @@
+/**
+ * @file NodePool.h
+ * @brief Contains the node pool class template
+ *
+ * Slab allocator used by the linked Queue and Stack for their nodes.
+ * Nodes are carved out of slabs that grow in chunks, released nodes go
+ * on a free list for reuse, and all slabs are freed at once on destruction.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+template <typename Node>
+class NodePool {
+private:
+    // A slot either holds a live node or links to the next free slot
+    union Slot {
+        Slot* nextFree;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    std::vector<Slot*> slabs;  // Every slab allocated so far, freed together
+    Slot* freeList;            // Released slots ready for reuse
+    Slot* slabCursor;          // Next never-used slot in the newest slab
+    Slot* slabEnd;             // One past the last slot in the newest slab
+    std::size_t nextSlabSize;  // Slots in the next slab, doubles up to a cap
+
+    static const std::size_t firstSlabSize = 64;
+    static const std::size_t maxSlabSize = 65536;
+
+    void grow() {
+        Slot* slab = static_cast<Slot*>(::operator new(nextSlabSize * sizeof(Slot)));
+        slabs.push_back(slab);
+        slabCursor = slab;
+        slabEnd = slab + nextSlabSize;
+        if (nextSlabSize < maxSlabSize) {
+            nextSlabSize *= 2;
+        }
+    }
+
+    void releaseSlabs() {
+        for (Slot* slab : slabs) {
+            ::operator delete(slab);
+        }
+        slabs.clear();
+        freeList = nullptr;
+        slabCursor = nullptr;
+        slabEnd = nullptr;
+        nextSlabSize = firstSlabSize;
+    }
+
+public:
+    NodePool() : freeList(nullptr), slabCursor(nullptr), slabEnd(nullptr), nextSlabSize(firstSlabSize) {}
+
+    // A pool owns its slabs, so containers copy their nodes into a pool of their own instead
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // Frees every slab in one go, nodes must already be destroyed
+    ~NodePool() { releaseSlabs(); }
+
+    // Construct a node in a free slot, growing the pool if none are left
+    template <typename... Args>
+    Node* allocate(Args&&... args) {
+        Slot* slot;
+        if (freeList != nullptr) {
+            slot = freeList;
+            freeList = freeList->nextFree;
+        } else {
+            if (slabCursor == slabEnd) {
+                grow();
+            }
+            slot = slabCursor++;
+        }
+        return new (slot->storage) Node{std::forward<Args>(args)...};
+    }
+
+    // Destroy a node and put its slot on the free list
+    void release(Node* node) {
+        node->~Node();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->nextFree = freeList;
+        freeList = slot;
+    }
+};
@@ -0,0 +1,19 @@
+/**
+ * @file OutputLevel.h
+ * @brief Contains the output level definition
+ *
+ * Contains the definition of the OutputLevel enum.
+ * Every scheduler run takes one to decide how much it prints.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+
+enum class OutputLevel {
+    NONE,      // Print nothing, run at full speed
+    SUMMARY,   // Print only the totals at the end
+    TIMELINE,  // Print the scrolling status display, the totals and each thread's latencies
+    LATENCY    // Print the totals and each thread's latencies, without the display
+};
@@ -0,0 +1,163 @@
+/**
+ * @file ParameterSweep.cpp
+ * @brief Parameter sweep implementation.
+ *
+ * Enumerates the sweep combinations up front, then worker threads claim
+ * them one at a time from an atomic counter and simulate them.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "ParameterSweep.h"
+#include "RateMonotonic.h"
+#include "RoundRobin.h"
+#include <atomic>
+#include <stdio.h>   // For printf
+#include <stdlib.h>  // For strtol
+#include <thread>
+
+// Parse one positive field of a range, advancing past it
+static bool parseRangeField(const char*& text, int& value) {
+    char* end = nullptr;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || parsed < 1 || parsed > 1000000000L) {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    text = end;
+    return true;
+}
+
+bool SweepRange::parse(const std::string& text) {
+    const char* cursor = text.c_str();
+    if (!parseRangeField(cursor, first)) {
+        return false;
+    }
+    last = first;
+    step = 1;
+    if (*cursor == ':') {
+        cursor++;
+        if (!parseRangeField(cursor, last)) {
+            return false;
+        }
+        if (*cursor == ':') {
+            cursor++;
+            if (!parseRangeField(cursor, step)) {
+                return false;
+            }
+        }
+    }
+    return *cursor == '\0' && first <= last;
+}
+
+std::vector<int> SweepRange::values() const {
+    std::vector<int> result;
+    for (long long value = first; value <= last; value += step) {
+        result.push_back(static_cast<int>(value));
+    }
+    return result;
+}
+
+// Simulate one combination with the given switch costs on schedulers owned by the calling worker
+static SimulationStats simulatePoint(const SweepPoint& point, long long horizon, const SwitchCosts& costs) {
+    std::vector<Thread> threadSet(point.threadCount);
+    for (int i = 0; i < point.threadCount; ++i) {
+        threadSet[i] = {i + 1, point.size, point.frequency};
+    }
+
+    if (point.roundRobin) {
+        RoundRobinScheduler scheduler(threadSet);
+        scheduler.setTimeQuantum(point.quantum);
+        scheduler.setSwitchCosts(costs);
+        return scheduler.simulate(horizon);
+    }
+    RateMonotonicScheduler scheduler(threadSet);
+    scheduler.setSwitchCosts(costs);
+    return scheduler.simulate(horizon);
+}
+
+std::vector<SweepPoint> runSweep(const SweepOptions& options, unsigned& workersUsed) {
+    std::vector<SweepPoint> points;
+    for (int threadCount : options.threadCounts.values()) {
+        for (int size : options.sizes.values()) {
+            for (int frequency : options.frequencies.values()) {
+                if (options.rateMonotonic) {
+                    points.push_back({false, threadCount, size, frequency, 0, {0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 0}});
+                }
+                if (options.roundRobin) {
+                    for (int quantum : options.quanta.values()) {
+                        points.push_back({true, threadCount, size, frequency, quantum, {0, 0, 0, 0, 0, 0, 0, 0},
+                                          {0, 0, 0, 0, 0, 0, 0, 0}});
+                    }
+                }
+            }
+        }
+    }
+
+    unsigned workerCount = options.workers;
+    if (workerCount == 0) {
+        workerCount = std::thread::hardware_concurrency();
+    }
+    if (workerCount == 0) {
+        workerCount = 1;
+    }
+    if (workerCount > points.size()) {
+        workerCount = static_cast<unsigned>(points.empty() ? 1 : points.size());
+    }
+    workersUsed = workerCount;
+
+    // Each point is claimed by exactly one worker, which is the only one to write it
+    std::atomic<size_t> nextPoint(0);
+    auto worker = [&]() {
+        for (;;) {
+            size_t index = nextPoint.fetch_add(1, std::memory_order_relaxed);
+            if (index >= points.size()) {
+                return;
+            }
+            SweepPoint& point = points[index];
+            point.stats = simulatePoint(point, options.horizon, options.switchCosts);
+            if (options.switchCosts.any()) {
+                point.withoutCosts = simulatePoint(point, options.horizon, SwitchCosts());
+            }
+        }
+    };
+
+    // The calling thread works too, so one worker means no extra threads at all
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < workerCount; ++i) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+    return points;
+}
+
+void printSweep(const std::vector<SweepPoint>& points, const SweepOptions& options) {
+    bool charged = options.switchCosts.any();
+    double perThousand = options.horizon > 0 ? 1000.0 / options.horizon : 0.0;  // Serviced to tasks per 1000 ticks
+    printf("%-4s %8s %6s %10s %8s %12s %14s %14s %14s", "algo", "threads", "size", "frequency", "quantum",
+           "utilization", "created", "serviced", "backlog");
+    if (charged) {
+        printf(" %12s %10s %10s %10s", "switches", "overhead %", "tput/1k", "free tput");
+    }
+    printf("\n");
+    for (const SweepPoint& point : points) {
+        double utilization = static_cast<double>(point.threadCount) * point.size / point.frequency;
+        printf("%-4s %8d %6d %10d ", point.roundRobin ? "RR" : "RM", point.threadCount, point.size, point.frequency);
+        if (point.roundRobin) {
+            printf("%8d ", point.quantum);
+        } else {
+            printf("%8s ", "-");
+        }
+        printf("%12.3f %14lld %14lld %14lld", utilization, point.stats.tasksCreated, point.stats.tasksServiced,
+               point.stats.tasksCreated - point.stats.tasksServiced);
+        if (charged) {
+            printf(" %12lld %10.2f %10.3f %10.3f", point.stats.contextSwitches, point.stats.overheadTicks * perThousand / 10.0,
+                   point.stats.tasksServiced * perThousand, point.withoutCosts.tasksServiced * perThousand);
+        }
+        printf("\n");
+    }
+}
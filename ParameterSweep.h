@@ -0,0 +1,60 @@
+/**
+ * @file ParameterSweep.h
+ * @brief Contains the parameter sweep definitions
+ *
+ * Runs the event-driven rate monotonic and round robin simulations over
+ * every combination of thread count, task size, frequency and quantum.
+ * Each combination is n identical threads of the given size and frequency,
+ * with priorities in thread order. With switch costs each combination also
+ * runs with free switches, so the table shows what the overhead costs in
+ * throughput. Combinations are spread over a pool of
+ * worker threads that each build their own schedulers and write to their
+ * own result slots, so workers share nothing but the next-combination counter.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "SchedulerCommon.h"
+#include <string>
+#include <vector>
+
+// Inclusive range of values, "first", "first:last" or "first:last:step"
+struct SweepRange {
+    int first = 1;
+    int last = 1;
+    int step = 1;
+
+    bool parse(const std::string& text);  // False unless every part is a positive number and first <= last
+    std::vector<int> values() const;
+};
+
+struct SweepOptions {
+    bool rateMonotonic = true;
+    bool roundRobin = true;
+    SweepRange threadCounts;
+    SweepRange sizes;
+    SweepRange frequencies;
+    SweepRange quanta;         // Only applies to round robin
+    SwitchCosts switchCosts;   // Charged in every combination, free by default
+    long long horizon = 10008;
+    unsigned workers = 0;      // 0 uses every hardware thread
+};
+
+// One simulated combination and its totals
+struct SweepPoint {
+    bool roundRobin;
+    int threadCount;
+    int size;
+    int frequency;
+    int quantum;  // 0 for rate monotonic
+    SimulationStats stats;
+    SimulationStats withoutCosts;  // The same combination with free switches, only run when switches cost
+};
+
+// Simulate every combination, results come back in the order they are enumerated
+std::vector<SweepPoint> runSweep(const SweepOptions& options, unsigned& workersUsed);
+
+// Table of created, serviced and backlog per combination, and switches and throughput when switches cost
+void printSweep(const std::vector<SweepPoint>& points, const SweepOptions& options);
@@ -11,21 +11,43 @@
 
 #include "Queue.h"
 #include <stdio.h>  // For printf
-#include <stdlib.h> // For rand
-#include <ctime>    // For time(NULL)
+#include <type_traits>
+
+static_assert(std::is_trivially_destructible<QueueNode>::value, "Queue nodes are freed in bulk with the pool");
 
 // Constructor and Destructor
-Queue::Queue() : head(nullptr), tail(nullptr) {}
+Queue::Queue() : head(nullptr), tail(nullptr), count(0), arrivals(nullptr) {}
 
+// Nodes hold plain task data, so the pool frees them all with its slabs
 Queue::~Queue() {
-    while (!isEmpty()) {
-        pop();
+    head = nullptr;
+    tail = nullptr;
+}
+
+// Copy every task front to end, so the copy pops them in the same order
+Queue::Queue(const Queue& other) : head(nullptr), tail(nullptr), count(0), arrivals(other.arrivals) {
+    for (QueueNode* current = other.head; current != nullptr; current = current->nextTask) {
+        push(current->taskData);
+    }
+}
+
+// Empty the queue into its own pool, then copy the other one's tasks in
+Queue& Queue::operator=(const Queue& other) {
+    if (this != &other) {
+        while (!isEmpty()) {
+            pop();
+        }
+        for (QueueNode* current = other.head; current != nullptr; current = current->nextTask) {
+            push(current->taskData);
+        }
+        arrivals = other.arrivals;
     }
+    return *this;
 }
 
 // Push method to add task at the end (tail) of the queue
 void Queue::push(Task task) {
-    QueueNode* newNode = new QueueNode{task, nullptr, tail};  // Create new node with task data
+    QueueNode* newNode = nodePool.allocate(task, nullptr, tail);  // Create new node with task data
 
     // If the queue is not empty, link the new node as the nextTask of the tail
     if (tail != nullptr) {
@@ -37,6 +59,7 @@ void Queue::push(Task task) {
     if (head == nullptr) {
         head = newNode;
     }
+    count++;
 }
 
 // Pop method to remove task from the head (front) of the queue
@@ -51,7 +74,8 @@ void Queue::pop() {
             tail = nullptr;  // If the queue is now empty, set tail to null
         }
 
-        delete temp; // Delete the old head
+        nodePool.release(temp); // Return the old head to the pool
+        count--;
     } else {
         printf("Queue is empty, cannot pop\n");
     }
@@ -68,10 +92,15 @@ Task* Queue::top() {
 }
 
 // Bool to check if the queue is empty
-bool Queue::isEmpty() {
+bool Queue::isEmpty() const {
     return head == nullptr;
 }
 
+// Number of tasks in the queue
+size_t Queue::size() const {
+    return count;
+}
+
 // Function to print the queue from front to end
 void Queue::printQueue() {
     printf("| ");
@@ -85,24 +114,40 @@ void Queue::printQueue() {
 
 // Queue scheduler example function
 void Queue::runExample() {
-    srand(static_cast<unsigned int>(time(NULL)));  // Seed the random number generator
+    run(10001, OutputLevel::TIMELINE);  // Example runs for 10001 "time units"
+}
+
+// Later runs take their tasks from source, nullptr goes back to the default workload
+void Queue::setArrivals(ArrivalSource* source) {
+    arrivals = source;
+}
+
+// Queue scheduler loop, only prints the queue each "time unit" at timeline output
+void Queue::run(long long horizon, OutputLevel output) {
+    // Without a source, 20% chance of a task between 1 and 6 "time units" each "time unit"
+    WorkloadOptions defaultWorkload;
+    defaultWorkload.seed = randomSeed();
+    WorkloadGenerator generator(defaultWorkload);
+    ArrivalSource* source = (arrivals != nullptr) ? arrivals : &generator;
 
     // Counters for tasks created and serviced
-    int taskCounter = 0;
-    int servicedCounter = 0;
+    long long taskCounter = 0;
+    long long servicedCounter = 0;
 
-    int timeCounter = 0;  
-    while (timeCounter <= 10000) {  // Example runs for 1000 "time units"
+    long long timeCounter = 0;  
+    while (timeCounter < horizon) {
 
-        // 20% chance of adding a new task each "time unit"
-        if (rand() % 5 == 0) {
-            Task newTask(rand() % 6 + 1);  // req between 1 and 5 "time units"
-            push(newTask);
+        // Add every arrival due this "time unit", the thread is ignored
+        Arrival arrival;
+        while (source->next(timeCounter, arrival)) {
+            push(Task(arrival.size, timeCounter));
             taskCounter++;  // Increment task counter
         }
 
         // Print the current queue
-        printQueue();
+        if (output == OutputLevel::TIMELINE) {
+            printQueue();
+        }
         
         // Iterate front task's serviced counter
         if (!isEmpty()) {
@@ -122,6 +167,8 @@ void Queue::runExample() {
     }
 
     // Print tasks completed and tasks left in queue
-    printf("Tasks completed: %d\n", servicedCounter);
-    printf("Tasks left in queue: %d\n", taskCounter);
+    if (output != OutputLevel::NONE) {
+        printf("Tasks completed: %lld\n", servicedCounter);
+        printf("Tasks left in queue: %lld\n", taskCounter);
+    }
 }
\ No newline at end of file
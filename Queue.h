@@ -12,6 +12,10 @@
 
 #pragma once
 #include "Task.h"
+#include "ArrivalTrace.h"
+#include "Workload.h"
+#include "NodePool.h"
+#include "OutputLevel.h"
 
 struct QueueNode {
     Task taskData;
@@ -23,19 +27,29 @@ class Queue {
 private:
     QueueNode* head;  // Front of the queue
     QueueNode* tail;  // End of the queue
+    size_t count;     // Number of tasks queued
+    NodePool<QueueNode> nodePool;  // Slab storage for the nodes
+    ArrivalSource* arrivals;  // Where tasks come from, a randomly seeded default workload when not set
 public:
 
     // Constructor and Destructor
     Queue();
     ~Queue();
 
+    // Copies get their own nodes, in a pool of their own
+    Queue(const Queue& other);
+    Queue& operator=(const Queue& other);
+
     // Push and Pop methods
     void push(Task task);
     void pop();
 
     Task* top();     // Pointer for front task, so it can be accessed without popping
-    bool isEmpty();  // Bool to check if the queue is empty
+    bool isEmpty() const;  // Bool to check if the queue is empty
+    size_t size() const;   // Number of tasks in the queue
 
     void printQueue();  // Function to print the queue
     void runExample();  // Function to run the example
+    void run(long long horizon, OutputLevel output);  // Run for any horizon at the given output level
+    void setArrivals(ArrivalSource* source);  // Take arrivals from source in later runs, nullptr goes back to the default workload
 };
@@ -3,7 +3,7 @@
  * @brief Rate monotonic scheduler implementation.
  * 
  * Example of a scheduler implemented using rate monotonic scheduling.
- * Uses 4 threads using "Queues" to simulate a rate monotonic scheduler.
+ * Uses a table of threads using "Queues" to simulate a rate monotonic scheduler.
  * 
  * @date 10/31/24
  * @authors Fiya Clerget, Marcello Novak
@@ -11,151 +11,401 @@
 
 #include "RateMonotonic.h"
 #include "ASCII.h"    // For coloring
-#include <algorithm>  // For find_if
+#include "ScheduleTrace.h"
+#include "StaticTaskSet.h"
+#include "SteadyState.h"
+#include "LatencyHistogram.h"
+#include "TickEngine.h"
+#include "AsyncTimelineRenderer.h"
+#include <algorithm>  // For max, min, stable_sort
 
 
 using namespace std;
 
-// Constructor initializes threads and next release times based on example type
-RateMonotonicScheduler::RateMonotonicScheduler(ExampleType exampleType) {
-    if (exampleType == ExampleType::STRUCTURED) {
-        // Structured example initialization
-        threads = {
-            {Queue(), 1, 1, 3},   // Thread 1: priority 1, size 1, frequency 3
-            {Queue(), 2, 2, 6},   // Thread 2: priority 2, size 2, frequency 6
-            {Queue(), 3, 2, 12},  // Thread 3: priority 3, size 2, frequency 12
-            {Queue(), 4, 4, 24}   // Thread 4: priority 4, size 4, frequency 24
-        };
-    } else if (exampleType == ExampleType::STARVED) {
-        // Starved example initialization
-        threads = {
-            {Queue(), 1, 1, 3},   // Thread 1: priority 1, size 1, frequency 3
-            {Queue(), 2, 2, 6},   // Thread 2: priority 2, size 2, frequency 6
-            {Queue(), 3, 4, 12},  // Thread 3: priority 3, size 4, frequency 12
-            {Queue(), 4, 4, 24}   // Thread 4: priority 4, size 4, frequency 24
-        };
+// Thread tables for the built-in examples, declared constexpr in StaticTaskSet.h
+vector<Thread> RateMonotonicScheduler::exampleThreadSet(ExampleType exampleType) {
+    if (exampleType == ExampleType::STARVED) {
+        return vector<Thread>(rateMonotonicStarved.begin(), rateMonotonicStarved.end());
     }
+    return vector<Thread>(rateMonotonicStructured.begin(), rateMonotonicStructured.end());
+}
+
+// Constructor initializes threads and next release times based on example type
+RateMonotonicScheduler::RateMonotonicScheduler(ExampleType exampleType)
+    : RateMonotonicScheduler(exampleThreadSet(exampleType)) {}
+
+// Constructor initializes threads and next release times from a loaded thread set
+RateMonotonicScheduler::RateMonotonicScheduler(const vector<Thread>& threadSet) {
+    threads.assign(threadSet);
+    taskDeadlines.resize(threads.count());
 
     // Set initial next release times based on the threads' frequencies
-    for (const Thread& thread : threads) {
-        nextReleaseTimes.push_back(thread.frequency);
+    for (int frequency : threads.frequencies) {
+        nextReleaseTimes.push_back(frequency);
     }
+
+    buildPriorityIndex();
 }
+
 // Destructor to clear the queues in each thread
 RateMonotonicScheduler::~RateMonotonicScheduler() {
-    for (Thread& thread : threads) {
-        while (!thread.taskQueue.isEmpty()) {
-            thread.taskQueue.pop();
+    for (TaskQueue& taskQueue : threads.taskQueues) {
+        while (!taskQueue.isEmpty()) {
+            taskQueue.pop();
         }
     }
 }
 
-// Main scheduler loop with scrolling thread status display
+// Example run with the scrolling thread status display
 void RateMonotonicScheduler::runExample() {
-    const int frameBoundary = 24;
-    int taskCounter = 0;
-    int servicedCounter = 0;
-
-    int timeCounter = 0;
-    while (timeCounter < 10008) {
-        if (timeCounter % frameBoundary == 0) {
-            setColor(COLOR_WHITE);
-            cout << "█▓▒░█▓▒░█▓▒░█▓▒░ | New Frame\n";
+    runTicks(10008, OutputLevel::TIMELINE);
+}
+
+// Run for any horizon, printing as much as the output level asks for
+void RateMonotonicScheduler::run(long long horizon, OutputLevel output) {
+    if (output == OutputLevel::TIMELINE || output == OutputLevel::LATENCY || trace != nullptr || arrivals != nullptr) {
+        runTicks(horizon, output);
+        return;
+    }
+
+    SimulationStats stats = simulate(horizon);
+    if (output == OutputLevel::SUMMARY) {
+        cout << "Total tasks created: " << stats.tasksCreated << endl;
+        cout << "Total tasks serviced: " << stats.tasksServiced << endl;
+        reportSwitches(stats.contextSwitches, stats.preemptions, stats.overheadTicks, stats.tasksServiced, horizon);
+    }
+}
+
+// Record every tick of later runs to a trace, nullptr stops recording
+void RateMonotonicScheduler::setTrace(TraceWriter* traceWriter) {
+    trace = traceWriter;
+}
+
+// Take releases from an arrival trace in later runs, which then go tick by tick
+void RateMonotonicScheduler::setArrivals(ArrivalSource* source) {
+    arrivals = source;
+}
+
+// Switches cost nothing until this is called
+void RateMonotonicScheduler::setSwitchCosts(const SwitchCosts& costs) {
+    switchCosts.switchTicks = max(costs.switchTicks, 0);
+    switchCosts.refillTicks = max(costs.refillTicks, 0);
+}
+
+// Release a task for the thread if it is due, thread 0 counts every thread down to its next release
+int RateMonotonicScheduler::releaseTick(size_t threadIndex, long long time) {
+    if (threadIndex == 0) {
+        releases.advance();
+    }
+    if (!releases.isReleased(threadIndex)) {
+        return 0;
+    }
+    addTask(threads.priorities[threadIndex], time, nextReleaseTimes[threadIndex] + threads.frequencies[threadIndex]);
+    nextReleaseTimes[threadIndex] += threads.frequencies[threadIndex];
+    return 1;
+}
+
+// Tasks go into the queue of the first thread with the same priority
+size_t RateMonotonicScheduler::releaseQueue(size_t threadIndex) {
+    return static_cast<size_t>(findThreadByPriority(threads.priorities[threadIndex]));
+}
+
+// Release the thread's arrivals from the source, each due one period after it arrives
+int RateMonotonicScheduler::releaseArrivals(size_t threadIndex, long long time) {
+    if (threadIndex == 0) {
+        arrivalBatch.collect(*arrivals, time, threads.count());
+    }
+    int released = 0;
+    Arrival arrival;
+    while (arrivalBatch.next(threadIndex, arrival)) {
+        queueTask(releaseQueue(threadIndex), Task(arrival.size, time), time + threads.frequencies[threadIndex]);
+        released++;
+    }
+    return released;
+}
+
+// The highest-priority thread with a task runs
+TickSelection RateMonotonicScheduler::selectTick() {
+    int highestPriorityThreadIndex = highestPriorityThread();
+    return {highestPriorityThreadIndex, highestPriorityThreadIndex != -1};
+}
+
+TickCell RateMonotonicScheduler::tickCell(size_t threadIndex, TickSelection selection, bool created) {
+    bool isRunning = (threadIndex == static_cast<size_t>(selection.thread));
+
+    if (isRunning && created) {
+        // Turquoise if a task is both created and executed in this time unit
+        return {&COLOR_TURQUOISE, "█▓▒░"};
+    } else if (isRunning) {
+        // Green if this is the highest-priority task running
+        return {&COLOR_GREEN, "█▓▒░"};
+    } else if (created) {
+        // Yellow if a task is created but preempted by a higher-priority task
+        return {&COLOR_YELLOW, "█▓▒░"};
+    } else if (!threads.taskQueues[threadIndex].isEmpty() && threadIndex > static_cast<size_t>(selection.thread)) {
+        // Red only if a lower-priority task is preempted (higher threads are never preempted by lower threads)
+        return {&COLOR_RED, "█▓▒░"};
+    }
+    // Gray if no tasks are in the queue or the thread isn't preempted
+    return {&COLOR_GRAY, "░░░░"};
+}
+
+// Service the selected task for one tick, true if it finished
+bool RateMonotonicScheduler::serviceTick(TickSelection selection, long long time) {
+    if (!selection.hasTask) {
+        return false;
+    }
+    size_t threadIndex = static_cast<size_t>(selection.thread);
+    Task* runningTask = threads.taskQueues[threadIndex].top();
+    if (runningTask->getFirstRunTick() < 0) {
+        runningTask->setFirstRunTick(time);
+    }
+    incrementTopTask(threads.priorities[threadIndex]);
+
+    if (runningTask->getServiced() != runningTask->getRequested()) {
+        return false;
+    }
+    runningTask->setCompletionTick(time + 1);
+    tickLatencies[threadIndex].record(*runningTask, *taskDeadlines[threadIndex].top());
+    removeTopTask(threadIndex, time + 1);
+    return true;
+}
+
+// Main scheduler loop with scrolling thread status display
+TickTotals RateMonotonicScheduler::runTicks(long long horizon, OutputLevel output) {
+    tickLatencies.assign(threads.count(), ThreadLatency(horizon));
+    releases.reset(threads.frequencies, nextReleaseTimes);
+
+    TickTotals totals;
+    if (arrivals != nullptr) {
+        totals = replayTicks(horizon, output);
+    } else if (output == OutputLevel::TIMELINE) {
+        AsyncTimelineRenderer renderer;  // Draws on its own thread, so a slow terminal doesn't hold up the run
+        totals = runTickEngine(*this, renderer, threads.count(), horizon, trace, switchCosts);
+    } else {
+        NullRenderer renderer;
+        totals = runTickEngine(*this, renderer, threads.count(), horizon, trace, switchCosts);
+    }
+    recordUnfinished(horizon);
+    reportTicks(totals, horizon, output);
+    return totals;
+}
+
+// Kept apart from runTicks so the periodic loop there stays small enough to inline its hooks
+TickTotals RateMonotonicScheduler::replayTicks(long long horizon, OutputLevel output) {
+    ArrivalReleases<RateMonotonicScheduler> replay(*this);
+    if (output == OutputLevel::TIMELINE) {
+        AsyncTimelineRenderer renderer;
+        return runTickEngine(replay, renderer, threads.count(), horizon, trace, switchCosts);
+    }
+    NullRenderer renderer;
+    return runTickEngine(replay, renderer, threads.count(), horizon, trace, switchCosts);
+}
+
+// Tasks still queued count against the queue they wait in, like the finished ones
+void RateMonotonicScheduler::recordUnfinished(long long horizon) {
+    for (size_t i = 0; i < threads.count(); ++i) {
+        forEachQueued(taskDeadlines[i], [&](long long deadline) { tickLatencies[i].recordUnfinished(deadline, horizon); });
+    }
+}
+
+void RateMonotonicScheduler::reportTicks(const TickTotals& totals, long long horizon, OutputLevel output) {
+    if (output != OutputLevel::NONE) {
+        cout << "Total tasks created: " << totals.tasksCreated << endl;
+        cout << "Total tasks serviced: " << totals.tasksServiced << endl;
+        reportSwitches(totals.contextSwitches, totals.preemptions, totals.overheadTicks, totals.tasksServiced, horizon);
+        if (arrivals != nullptr && arrivalBatch.ignored() > 0) {
+            cout << "Arrivals for threads not in the set: " << arrivalBatch.ignored() << endl;
         }
+    }
+    if (output == OutputLevel::TIMELINE || output == OutputLevel::LATENCY) {
+        printLatencyReport(tickLatencies);
+    }
+}
+
+void RateMonotonicScheduler::reportSwitches(long long switches, long long preemptions, long long overheadTicks,
+                                            long long serviced, long long horizon) {
+    cout << "Context switches: " << switches << endl;
+    cout << "Preemptions: " << preemptions << endl;
+    if (switchCosts.any() && horizon > 0) {
+        cout << "Switch overhead: " << overheadTicks << " time units (" << 100.0 * overheadTicks / horizon << "%)" << endl;
+        cout << "Throughput: " << 1000.0 * serviced / horizon << " tasks per 1000 time units" << endl;
+    }
+}
 
-        // Track which threads have new tasks created in this time unit
-        vector<bool> taskCreated(threads.size(), false);
+// Event-driven scheduler loop, jumps straight to the next release or task completion
+// Gives the same totals as runTicks over the same horizon, without the display
+SimulationStats RateMonotonicScheduler::simulate(long long horizon) {
+    SimulationStats stats = {0, 0, 0, 0, 0, 0, 0, 0};
+    SwitchTracker switches;
+    vector<long long> firstReleases = nextReleaseTimes;
 
-        // Add tasks based on release times
-        for (size_t i = 0; i < threads.size(); ++i) {
-            if (timeCounter >= nextReleaseTimes[i]) {
-                addTask(threads[i].priority);
-                nextReleaseTimes[i] += threads[i].frequency;
-                taskCounter++;
-                taskCreated[i] = true;  // Mark that a task was created for this thread
-            }
+    // Threads first release at their frequency, so the full release pattern starts one hyperperiod in
+    // A queue fed by several threads holds a mix of deadlines, so it only repeats when it matches exactly
+    SteadyStateDetector steadyState;
+    steadyState.start(threads, horizon, 1);
+    for (size_t i = 0; i < threads.count(); ++i) {
+        int owner = findThreadByPriority(threads.priorities[i]);
+        if (owner != static_cast<int>(i)) {
+            steadyState.requireExactLength(static_cast<size_t>(owner));
         }
+    }
 
-        // Get and service the highest-priority task
-        Task* highestPriorityTask = nullptr;
-        int highestPriorityThreadIndex = -1;
+    long long timeCounter = 0;
+    long long nextRelease = 0;
+    while (timeCounter < horizon) {
+        // Once a hyperperiod repeats, every remaining whole one plays out the same way
+        if (timeCounter == steadyState.nextBoundary() && steadyState.atBoundary(threads, stats, 0, 0, switches)) {
+            long long periods = (horizon - timeCounter) / steadyState.period();
+            long long skipped = periods * steadyState.period();
+            stats.tasksCreated += periods * steadyState.growthPerPeriod().tasksCreated;
+            stats.tasksServiced += periods * steadyState.growthPerPeriod().tasksServiced;
+            stats.deadlineMisses += periods * steadyState.growthPerPeriod().deadlineMisses;
+            stats.contextSwitches += periods * steadyState.growthPerPeriod().contextSwitches;
+            stats.preemptions += periods * steadyState.growthPerPeriod().preemptions;
+            stats.overheadTicks += periods * steadyState.growthPerPeriod().overheadTicks;
+            stats.extrapolatedTicks = skipped;
+            for (long long& releaseTime : nextReleaseTimes) {
+                releaseTime += skipped;
+            }
 
-        // Find the highest-priority task
-        for (size_t i = 0; i < threads.size(); ++i) {
-            Thread& thread = threads[i];
-            if (!thread.taskQueue.isEmpty()) {
-                Task* topTask = thread.taskQueue.top();
-                if (highestPriorityTask == nullptr || thread.priority < threads[static_cast<size_t>(highestPriorityThreadIndex)].priority) {
-                    highestPriorityTask = topTask;
-                    highestPriorityThreadIndex = static_cast<int>(i);
+            // Queued deadlines move with the clock, so relative to it nothing changes
+            for (RingQueue<long long>& deadlines : taskDeadlines) {
+                for (size_t queued = deadlines.size(); queued > 0; --queued) {
+                    deadlines.push(*deadlines.top() + skipped);
+                    deadlines.pop();
                 }
             }
+            timeCounter += skipped;
+            steadyState.stop();
+            continue;
         }
 
-        // Display thread statuses
-        for (size_t i = 0; i < threads.size(); ++i) {
-            bool isRunning = (i == static_cast<size_t>(highestPriorityThreadIndex));
-            bool isCreated = taskCreated[i];
-
-            if (isRunning && isCreated) {
-                // Turquoise if a task is both created and executed in this time unit
-                setColor(COLOR_TURQUOISE);
-                cout << "█▓▒░";
-            } else if (isRunning) {
-                // Green if this is the highest-priority task running
-                setColor(COLOR_GREEN);
-                cout << "█▓▒░";
-            } else if (isCreated && !isRunning) {
-                // Purple if a task is created but preempted by a higher-priority task
-                setColor(COLOR_YELLOW);
-                cout << "█▓▒░";
-            } else if (!threads[i].taskQueue.isEmpty() && i > static_cast<size_t>(highestPriorityThreadIndex)) {
-                // Red only if a lower-priority task is preempted (higher threads are never preempted by lower threads)
-                setColor(COLOR_RED);
-                cout << "█▓▒░";
-            } else {
-                // Gray if no tasks are in the queue or the thread isn't preempted
-                setColor(COLOR_GRAY);
-                cout << "░░░░";
+        // Add tasks based on release times and find the next release, only when one is due
+        if (timeCounter >= nextRelease) {
+            nextRelease = horizon;
+            for (size_t i = 0; i < threads.count(); ++i) {
+                if (timeCounter >= nextReleaseTimes[i]) {
+                    addTask(threads.priorities[i], timeCounter, nextReleaseTimes[i] + threads.frequencies[i]);
+                    nextReleaseTimes[i] += threads.frequencies[i];
+                    stats.tasksCreated++;
+                }
+                nextRelease = min(nextRelease, nextReleaseTimes[i]);
             }
         }
-        setColor(COLOR_WHITE);
-        cout << " | " << (timeCounter + 1) << endl;
 
-        if (highestPriorityTask != nullptr && highestPriorityThreadIndex != -1) {
-            incrementTopTask(threads[static_cast<size_t>(highestPriorityThreadIndex)].priority);
+        // Find the highest-priority task
+        int highestPriorityThreadIndex = highestPriorityThread();
+
+        // Nothing changes until the next release, unless the running task finishes or a switch is paid first
+        long long step = nextRelease - timeCounter;
+        int overhead = (highestPriorityThreadIndex != -1 && switchCosts.any())
+                           ? switches.overheadBefore(highestPriorityThreadIndex, switchCosts) : 0;
+        if (overhead > 0) {
+            step = min(step, static_cast<long long>(overhead));
+            switches.overheadLeft -= static_cast<int>(step);
+            stats.overheadTicks += step;
+        } else if (highestPriorityThreadIndex != -1) {
+            Task* runningTask = threads.taskQueues[static_cast<size_t>(highestPriorityThreadIndex)].top();
+            long long remaining = runningTask->getRequested() - runningTask->getServiced();
+            step = min(step, remaining);
 
-            if (highestPriorityTask->getServiced() == highestPriorityTask->getRequested()) {
-                threads[static_cast<size_t>(highestPriorityThreadIndex)].taskQueue.pop();
-                servicedCounter++;
+            runningTask->setServiced(runningTask->getServiced() + static_cast<int>(step));
+            bool finished = runningTask->getServiced() == runningTask->getRequested();
+            switches.record(highestPriorityThreadIndex, finished, stats.contextSwitches, stats.preemptions);
+            if (finished) {
+                if (removeTopTask(static_cast<size_t>(highestPriorityThreadIndex), timeCounter + step)) {
+                    stats.deadlineMisses++;
+                }
+                stats.tasksServiced++;
             }
         }
 
-        timeCounter++;
+        timeCounter += step;
     }
 
-    cout << "Total tasks created: " << taskCounter << endl;
-    cout << "Total tasks serviced: " << servicedCounter << endl;
+    // Tasks still queued past their deadline missed it too, however long they had left
+    stats.deadlineMisses += stats.tasksCreated - stats.tasksServiced - queuedNotYetDue(taskDeadlines, horizon);
+    stats.tasksDue = tasksDueWithin(threads.frequencies, firstReleases, horizon);
+    return stats;
 }
 
-void RateMonotonicScheduler::addTask(int priority) {
-    auto it = find_if(threads.begin(), threads.end(), [priority](const Thread& t) {
-        return t.priority == priority;
+// Rank threads by priority (ties keep thread order) and keep the ranks' priority values for lookups
+void RateMonotonicScheduler::buildPriorityIndex() {
+    rankToThread.resize(threads.count());
+    threadRank.resize(threads.count());
+    rankPriorities.resize(threads.count());
+    readyThreads.resize(threads.count());
+
+    for (size_t i = 0; i < threads.count(); ++i) {
+        rankToThread[i] = i;
+    }
+    stable_sort(rankToThread.begin(), rankToThread.end(), [this](size_t a, size_t b) {
+        return threads.priorities[a] < threads.priorities[b];
     });
+    for (size_t rank = 0; rank < rankToThread.size(); ++rank) {
+        threadRank[rankToThread[rank]] = rank;
+        rankPriorities[rank] = threads.priorities[rankToThread[rank]];
+    }
+
+    for (size_t i = 0; i < threads.count(); ++i) {
+        if (!threads.taskQueues[i].isEmpty()) {
+            readyThreads.set(threadRank[i]);
+        }
+    }
+}
+
+// Thread index for a priority value, or -1 if no thread has it
+// Tasks for a priority go to the first thread that has it, which ties keeping thread order puts at the lowest rank
+// Searched rather than indexed by value, so sparse priorities as large as an int cost nothing extra
+int RateMonotonicScheduler::findThreadByPriority(int priority) {
+    vector<int>::const_iterator found = lower_bound(rankPriorities.begin(), rankPriorities.end(), priority);
+    if (found == rankPriorities.end() || *found != priority) {
+        return -1;
+    }
+    return static_cast<int>(rankToThread[static_cast<size_t>(found - rankPriorities.begin())]);
+}
+
+// Index of the highest-priority thread with a task, or -1 if every queue is empty
+int RateMonotonicScheduler::highestPriorityThread() {
+    size_t rank = readyThreads.findFirst();
+    if (rank == ReadyBitmap::npos) {
+        return -1;
+    }
+    return static_cast<int>(rankToThread[rank]);
+}
+
+void RateMonotonicScheduler::addTask(int priority, long long releaseTick, long long deadline) {
+    int threadIndex = findThreadByPriority(priority);
 
-    if (it != threads.end()) {
-        int requestedTime = it->size;
-        it->taskQueue.push(Task(requestedTime));
+    if (threadIndex != -1) {
+        queueTask(static_cast<size_t>(threadIndex), Task(threads.sizes[static_cast<size_t>(threadIndex)], releaseTick), deadline);
     }
 }
 
+void RateMonotonicScheduler::queueTask(size_t threadIndex, const Task& task, long long deadline) {
+    threads.taskQueues[threadIndex].push(task);
+    taskDeadlines[threadIndex].push(deadline);
+    readyThreads.set(threadRank[threadIndex]);
+}
+
 void RateMonotonicScheduler::incrementTopTask(int priority) {
-    auto it = find_if(threads.begin(), threads.end(), [priority](const Thread& t) {
-        return t.priority == priority;
-    });
+    int threadIndex = findThreadByPriority(priority);
 
-    if (it != threads.end() && !it->taskQueue.isEmpty()) {
-        Task* topTask = it->taskQueue.top();
+    if (threadIndex != -1 && !threads.taskQueues[static_cast<size_t>(threadIndex)].isEmpty()) {
+        Task* topTask = threads.taskQueues[static_cast<size_t>(threadIndex)].top();
         topTask->setServiced(topTask->getServiced() + 1);
     }
 }
+
+// Pop a finished task, and drop the thread from the ready set once its queue is empty
+bool RateMonotonicScheduler::removeTopTask(size_t threadIndex, long long finishTime) {
+    TaskQueue& taskQueue = threads.taskQueues[threadIndex];
+    bool missed = finishTime > *taskDeadlines[threadIndex].top();
+    taskQueue.pop();
+    taskDeadlines[threadIndex].pop();
+    if (taskQueue.isEmpty()) {
+        readyThreads.clear(threadRank[threadIndex]);
+    }
+    return missed;
+}
@@ -3,36 +3,87 @@
  * @brief Contains the rate monotonic class definitions
  * 
  * Contains the definition of the rate monotonic class and the node struct.
- * Uses 4 threads using "Queues" to simulate a rate monotonic scheduler.
+ * Uses a table of threads using "Queues" to simulate a rate monotonic scheduler.
  * 
  * @date 10/31/24
  * @author Fiya Clerget, Marcello Novak
  */
 
 #pragma once
+#include "ArrivalTrace.h"
+#include "LatencyHistogram.h"
+#include "OutputLevel.h"
 #include "Queue.h"
+#include "ReadyBitmap.h"
+#include "ReleaseCountdown.h"
 #include "SchedulerCommon.h"
+#include "ScheduleTrace.h"
 #include "Task.h"
+#include "TickEngine.h"
 #include <vector>
 #include <iostream>
 using namespace std;
 
 class RateMonotonicScheduler {
     protected:
-        vector<Thread> threads;       // Stores each thread with its queue, frequency, and ID
-        vector<int> nextReleaseTimes; // Tracks the next release time for each thread
+        ThreadTable threads;          // Stores each thread's queue, priority, size, and frequency
+        vector<long long> nextReleaseTimes; // Tracks the next release time for each thread
 
-        void addTask(int priority);
+        ReadyBitmap readyThreads;       // One bit per priority rank, set while that thread has tasks
+        vector<size_t> rankToThread;    // Thread index for each priority rank, highest priority first
+        vector<size_t> threadRank;      // Priority rank of each thread
+        vector<int> rankPriorities;     // Priority value of each rank, ascending, searched to find a value's first thread
+        TraceWriter* trace = nullptr;   // Receives every tick of tick by tick runs when set
+        SwitchCosts switchCosts;        // Ticks lost whenever a different thread gets the CPU, free by default
+        ArrivalSource* arrivals = nullptr;  // Replaces the periodic releases in tick by tick runs when set
+        ArrivalBatch arrivalBatch;          // Arrivals due this tick
+        ReleaseCountdown releases;          // Periodic releases of tick by tick runs, counted down for all threads at once
+        vector<RingQueue<long long>> taskDeadlines;  // Deadline of each queued task (its thread's next release), in queue order
+
+        void buildPriorityIndex();
+        int findThreadByPriority(int priority);
+        int highestPriorityThread();
+        void addTask(int priority, long long releaseTick, long long deadline);
+        void queueTask(size_t threadIndex, const Task& task, long long deadline);  // Push onto a queue and mark it ready
         void incrementTopTask(int priority);
-    public:
-        enum class ExampleType { STRUCTURED, STARVED };
+        bool removeTopTask(size_t threadIndex, long long finishTime);  // Returns true if the task missed its deadline
+
+        vector<ThreadLatency> tickLatencies;  // Latencies of the current tick by tick run
+        void recordUnfinished(long long horizon);  // Add the tasks still queued at the horizon to tickLatencies
+        void reportTicks(const TickTotals& totals, long long horizon, OutputLevel output);  // Totals and latencies at the end of runTicks
+        void reportSwitches(long long switches, long long preemptions, long long overheadTicks, long long serviced,
+                            long long horizon);  // Switch counts, and the overhead and throughput when switches cost
 
-        // Constructor and Destructor
+        // Tick engine hooks, see TickEngine.h
+        int releaseTick(size_t threadIndex, long long time);
+        int releaseArrivals(size_t threadIndex, long long time);
+        size_t releaseQueue(size_t threadIndex);
+        TickSelection selectTick();
+        TickCell tickCell(size_t threadIndex, TickSelection selection, bool created);
+        bool serviceTick(TickSelection selection, long long time);
+
+        template <typename Policy, typename Renderer>
+        friend TickTotals runTickEngine(Policy& policy, Renderer& renderer, size_t threadCount, long long horizon,
+                                        TraceWriter* trace, const SwitchCosts& costs);
+        template <typename Policy>
+        friend class ArrivalReleases;
+        TickTotals replayTicks(long long horizon, OutputLevel output);  // runTicks with the releases from arrivals
+    public:
+        // Constructors and Destructor
         RateMonotonicScheduler(ExampleType exampleType);
+        RateMonotonicScheduler(const vector<Thread>& threadSet);
         ~RateMonotonicScheduler();
 
+        static vector<Thread> exampleThreadSet(ExampleType exampleType);
+
         // Functions to run the examples
         void runExample();
+        void run(long long horizon, OutputLevel output);  // Timeline, traced or replayed runs go tick by tick, otherwise event-driven
+        TickTotals runTicks(long long horizon, OutputLevel output);  // Tick by tick run, with the status display at timeline output
+        SimulationStats simulate(long long horizon);      // Event-driven run with no display
+        void setTrace(TraceWriter* traceWriter);
+        void setArrivals(ArrivalSource* source);  // Release tasks from source instead of the frequencies, nullptr goes back
+        void setSwitchCosts(const SwitchCosts& costs);  // Charge every context switch in later runs
 
     
 };
\ No newline at end of file
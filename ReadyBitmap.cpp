@@ -0,0 +1,95 @@
+/**
+ * @file ReadyBitmap.cpp
+ * @brief Ready bitmap implementation.
+ *
+ * Implementation of the hierarchical ready bitmap.
+ * The lowest set slot is found with one count-trailing-zeros per level.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "ReadyBitmap.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Index of the lowest set bit, word must not be zero
+static inline size_t countTrailingZeros(uint64_t word) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<size_t>(index);
+#else
+    return static_cast<size_t>(__builtin_ctzll(word));
+#endif
+}
+
+// Constructors
+ReadyBitmap::ReadyBitmap() {
+    resize(0);
+}
+
+ReadyBitmap::ReadyBitmap(size_t slotCount) {
+    resize(slotCount);
+}
+
+// Build levels of 64-way summaries until one word covers everything
+void ReadyBitmap::resize(size_t slotCount) {
+    levels.clear();
+    size_t words = (slotCount + 63) / 64;
+    do {
+        if (words == 0) {
+            words = 1;
+        }
+        levels.push_back(std::vector<uint64_t>(words, 0));
+        words = (words + 63) / 64;
+    } while (levels.back().size() > 1);
+}
+
+// Set a slot, and mark its word in each summary level until one was already marked
+void ReadyBitmap::set(size_t slot) {
+    for (std::vector<uint64_t>& level : levels) {
+        uint64_t& word = level[slot / 64];
+        bool wasEmpty = (word == 0);
+        word |= uint64_t(1) << (slot % 64);
+        if (!wasEmpty) {
+            return;
+        }
+        slot /= 64;
+    }
+}
+
+// Clear a slot, and unmark its word in each summary level while words become empty
+void ReadyBitmap::clear(size_t slot) {
+    for (std::vector<uint64_t>& level : levels) {
+        uint64_t& word = level[slot / 64];
+        word &= ~(uint64_t(1) << (slot % 64));
+        if (word != 0) {
+            return;
+        }
+        slot /= 64;
+    }
+}
+
+bool ReadyBitmap::test(size_t slot) const {
+    return (levels[0][slot / 64] >> (slot % 64)) & 1;
+}
+
+bool ReadyBitmap::isEmpty() const {
+    return levels.back()[0] == 0;
+}
+
+// Walk down from the top summary word, taking the lowest set bit at each level
+size_t ReadyBitmap::findFirst() const {
+    if (isEmpty()) {
+        return npos;
+    }
+
+    size_t slot = 0;
+    for (size_t level = levels.size(); level-- > 0;) {
+        slot = slot * 64 + countTrailingZeros(levels[level][slot]);
+    }
+    return slot;
+}
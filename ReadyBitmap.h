@@ -0,0 +1,36 @@
+/**
+ * @file ReadyBitmap.h
+ * @brief Contains the ready bitmap class definition
+ *
+ * Hierarchical bitmap of ready slots, one bit per slot.
+ * Each level summarizes 64 words of the level below, so setting, clearing
+ * and finding the lowest set bit touch one word per level.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ReadyBitmap {
+private:
+    std::vector<std::vector<uint64_t>> levels;  // levels[0] holds the slot bits, the last level is one word
+public:
+    static const size_t npos = static_cast<size_t>(-1);
+
+    // Constructors
+    ReadyBitmap();
+    explicit ReadyBitmap(size_t slotCount);
+
+    void resize(size_t slotCount);  // Clears every bit and sizes the bitmap for slotCount slots
+
+    void set(size_t slot);
+    void clear(size_t slot);
+    bool test(size_t slot) const;
+    bool isEmpty() const;
+
+    size_t findFirst() const;  // Lowest set slot, or npos if none are set
+};
@@ -0,0 +1,123 @@
+/**
+ * @file ReleaseCountdown.cpp
+ * @brief Release countdown implementation.
+ *
+ * A lane releases when its countdown is zero, and then restarts from its
+ * period. Either way it counts down one, so a thread with period p is due
+ * again p ticks later. The instruction set is picked at compile time, with
+ * -march=native or /arch:AVX2 (the SCHEDULER_NATIVE option) for AVX2.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "ReleaseCountdown.h"
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define RELEASE_COUNTDOWN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RELEASE_COUNTDOWN_SSE2
+#endif
+
+using namespace std;
+
+static const int32_t neverDue = numeric_limits<int32_t>::max();
+
+void ReleaseCountdown::resize(size_t threadCount) {
+    size_t lanes = (threadCount + lanesPerPass - 1) / lanesPerPass * lanesPerPass;
+    countdowns.assign(lanes, neverDue);
+    periods.assign(lanes, neverDue);
+    released.assign((lanes + 63) / 64, 0);
+}
+
+void ReleaseCountdown::reset(const vector<int>& threadPeriods) {
+    resize(threadPeriods.size());
+    for (size_t i = 0; i < threadPeriods.size(); ++i) {
+        countdowns[i] = 0;
+        periods[i] = threadPeriods[i];
+    }
+}
+
+void ReleaseCountdown::reset(const vector<int>& threadPeriods, const vector<long long>& nextReleases) {
+    resize(threadPeriods.size());
+    for (size_t i = 0; i < threadPeriods.size(); ++i) {
+        long long countdown = nextReleases[i] < 0 ? 0 : nextReleases[i];
+        countdowns[i] = static_cast<int32_t>(countdown < neverDue ? countdown : neverDue);
+        periods[i] = threadPeriods[i];
+    }
+}
+
+// Passes never straddle a mask word, so the first pass of a word overwrites it and the rest add to it
+void ReleaseCountdown::advance() {
+#if defined(RELEASE_COUNTDOWN_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    for (size_t i = 0; i < countdowns.size(); i += lanesPerPass) {
+        __m256i* counts = reinterpret_cast<__m256i*>(countdowns.data() + i);
+        const __m256i* restarts = reinterpret_cast<const __m256i*>(periods.data() + i);
+        __m256i low = _mm256_loadu_si256(counts);
+        __m256i high = _mm256_loadu_si256(counts + 1);
+        __m256i lowDue = _mm256_cmpeq_epi32(low, zero);
+        __m256i highDue = _mm256_cmpeq_epi32(high, zero);
+        low = _mm256_blendv_epi8(low, _mm256_loadu_si256(restarts), lowDue);
+        high = _mm256_blendv_epi8(high, _mm256_loadu_si256(restarts + 1), highDue);
+        _mm256_storeu_si256(counts, _mm256_sub_epi32(low, one));
+        _mm256_storeu_si256(counts + 1, _mm256_sub_epi32(high, one));
+
+        uint64_t bits = static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lowDue))) |
+                        static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(highDue))) << 8;
+        uint64_t& word = released[i >> 6];
+        word = ((i & 63) == 0) ? bits : (word | bits << (i & 63));
+    }
+#elif defined(RELEASE_COUNTDOWN_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    for (size_t i = 0; i < countdowns.size(); i += lanesPerPass) {
+        __m128i* counts = reinterpret_cast<__m128i*>(countdowns.data() + i);
+        const __m128i* restarts = reinterpret_cast<const __m128i*>(periods.data() + i);
+        uint64_t bits = 0;
+        for (int part = 0; part < 4; ++part) {
+            __m128i count = _mm_loadu_si128(counts + part);
+            __m128i due = _mm_cmpeq_epi32(count, zero);
+            // No blend before SSE4.1, so take the period where due and the count elsewhere
+            count = _mm_or_si128(_mm_and_si128(due, _mm_loadu_si128(restarts + part)), _mm_andnot_si128(due, count));
+            _mm_storeu_si128(counts + part, _mm_sub_epi32(count, one));
+            bits |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(due))) << (4 * part);
+        }
+        uint64_t& word = released[i >> 6];
+        word = ((i & 63) == 0) ? bits : (word | bits << (i & 63));
+    }
+#else
+    advanceScalar();
+#endif
+}
+
+void ReleaseCountdown::advanceScalar() {
+    for (size_t i = 0; i < countdowns.size(); i += lanesPerPass) {
+        uint64_t bits = 0;
+        for (size_t lane = 0; lane < lanesPerPass; ++lane) {
+            bool due = (countdowns[i + lane] == 0);
+            bits |= static_cast<uint64_t>(due) << lane;
+            countdowns[i + lane] = (due ? periods[i + lane] : countdowns[i + lane]) - 1;
+        }
+        uint64_t& word = released[i >> 6];
+        word = ((i & 63) == 0) ? bits : (word | bits << (i & 63));
+    }
+}
+
+const vector<uint64_t>& ReleaseCountdown::releaseMask() const {
+    return released;
+}
+
+const char* ReleaseCountdown::instructionSet() {
+#if defined(RELEASE_COUNTDOWN_AVX2)
+    return "AVX2";
+#elif defined(RELEASE_COUNTDOWN_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
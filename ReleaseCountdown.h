@@ -0,0 +1,46 @@
+/**
+ * @file ReleaseCountdown.h
+ * @brief Contains the release countdown class definition
+ *
+ * Periodic release check for tick by tick runs of large thread sets. Each
+ * thread keeps a countdown to its next release instead of the scheduler
+ * testing the time against every thread's frequency, and once a tick one
+ * pass counts them all down together, leaving a bitmask of the threads
+ * that release on that tick. The pass uses AVX2, 8 threads per instruction,
+ * when the build targets it, SSE2, 4 per instruction, otherwise on x86, and
+ * a plain loop everywhere else. Every path gives the same bits, and
+ * advanceScalar() is always built so the vector ones can be checked.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ReleaseCountdown {
+private:
+    std::vector<int32_t> countdowns;  // Ticks to each thread's next release, padded to whole passes
+    std::vector<int32_t> periods;     // What a thread's countdown restarts from when it releases
+    std::vector<uint64_t> released;   // One bit per thread, set for the threads releasing this tick
+
+    void resize(size_t threadCount);  // Padding lanes count down from the largest period and never release in practice
+public:
+    static const size_t lanesPerPass = 16;  // Threads counted down per loop iteration on every path
+
+    // Every thread releases at time zero and then every periods[i] ticks
+    void reset(const std::vector<int>& threadPeriods);
+    // Thread i first releases at nextReleases[i], counting from time zero, within 2^31 ticks
+    void reset(const std::vector<int>& threadPeriods, const std::vector<long long>& nextReleases);
+
+    void advance();        // Set the bits of the threads releasing this tick, then count down to the next
+    void advanceScalar();  // The same without vector instructions
+
+    // Inline, the tick engine asks it for every thread every tick
+    bool isReleased(size_t thread) const { return (released[thread >> 6] >> (thread & 63) & 1) != 0; }
+    const std::vector<uint64_t>& releaseMask() const;  // Bits of the last advance, padding bits included
+
+    static const char* instructionSet();  // "AVX2", "SSE2" or "scalar", whichever advance() uses
+};
@@ -0,0 +1,118 @@
+/**
+ * @file RingQueue.h
+ * @brief Contains the ring queue class template
+ *
+ * Contiguous FIFO queue with the same push/pop/top/isEmpty interface as Queue.
+ * Elements live in a power-of-two ring buffer that doubles when full,
+ * so pushes and pops are amortized O(1) with no per-element allocation.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <cstddef>
+#include <new>
+#include <stdio.h>  // For printf
+#include <utility>
+
+template <typename T>
+class RingQueue {
+private:
+    T* buffer;             // Raw storage for capacity elements
+    std::size_t capacity;  // Always zero or a power of two
+    std::size_t head;      // Index of the front element
+    std::size_t count;     // Number of elements stored
+
+    static const std::size_t initialCapacity = 16;
+
+    T* slot(std::size_t offset) const {
+        return buffer + ((head + offset) & (capacity - 1));
+    }
+
+    // Move the elements into a buffer of twice the size, front first
+    void grow() {
+        std::size_t newCapacity = capacity == 0 ? initialCapacity : capacity * 2;
+        T* newBuffer = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+        for (std::size_t i = 0; i < count; ++i) {
+            T* element = slot(i);
+            new (newBuffer + i) T(std::move(*element));
+            element->~T();
+        }
+        ::operator delete(buffer);
+        buffer = newBuffer;
+        capacity = newCapacity;
+        head = 0;
+    }
+
+    void destroyAll() {
+        for (std::size_t i = 0; i < count; ++i) {
+            slot(i)->~T();
+        }
+        ::operator delete(buffer);
+        buffer = nullptr;
+        capacity = 0;
+        head = 0;
+        count = 0;
+    }
+
+public:
+    // Constructor and Destructor
+    RingQueue() : buffer(nullptr), capacity(0), head(0), count(0) {}
+    ~RingQueue() { destroyAll(); }
+
+    RingQueue(const RingQueue& other) : RingQueue() {
+        for (std::size_t i = 0; i < other.count; ++i) {
+            push(*other.slot(i));
+        }
+    }
+
+    RingQueue(RingQueue&& other) noexcept
+        : buffer(other.buffer), capacity(other.capacity), head(other.head), count(other.count) {
+        other.buffer = nullptr;
+        other.capacity = 0;
+        other.head = 0;
+        other.count = 0;
+    }
+
+    RingQueue& operator=(RingQueue other) noexcept {
+        std::swap(buffer, other.buffer);
+        std::swap(capacity, other.capacity);
+        std::swap(head, other.head);
+        std::swap(count, other.count);
+        return *this;
+    }
+
+    // Push method to add an element at the back of the ring
+    void push(const T& value) {
+        if (count == capacity) {
+            grow();
+        }
+        new (slot(count)) T(value);
+        count++;
+    }
+
+    // Pop method to remove the element at the front of the ring
+    void pop() {
+        if (!isEmpty()) {
+            slot(0)->~T();
+            head = (head + 1) & (capacity - 1);
+            count--;
+        } else {
+            printf("Queue is empty, cannot pop\n");
+        }
+    }
+
+    // Pointer for front element, so it can be accessed without popping
+    T* top() {
+        if (!isEmpty()) {
+            return slot(0);
+        } else {
+            printf("Queue is empty, cannot view top\n");
+            return nullptr;
+        }
+    }
+
+    bool isEmpty() const { return count == 0; }
+    std::size_t size() const { return count; }
+};
@@ -3,7 +3,7 @@
  * @brief Round Robin scheduler implementation.
  * 
  * Example of a scheduler implemented using round robin scheduling.
- * Creates 4 threads using "Queues" to simulate a round robin scheduler.
+ * Creates a table of threads using "Queues" to simulate a round robin scheduler.
  * 
  * @date 11/5/24
  * @author Fiya Clerget, Marcello Novak
@@ -11,177 +11,409 @@
 
 #include "RoundRobin.h"
 #include "ASCII.h"
+#include "ScheduleTrace.h"
+#include "StaticTaskSet.h"
+#include "SteadyState.h"
+#include "LatencyHistogram.h"
+#include "TickEngine.h"
+#include "AsyncTimelineRenderer.h"
 #include "SchedulerCommon.h"
+#include <algorithm>  // For max, min
 using namespace std;
 
-// Constructor initializes threads and next release times based on example type
-RoundRobinScheduler::RoundRobinScheduler(ExampleType exampleType) : currentThreadIndex(0) {
-    if (exampleType == ExampleType::STRUCTURED) {
-        // Structured example initialization
-        threads = {
-            {Queue(), 1, 2, 24},   // Thread 1: size 2, freq 24
-            {Queue(), 2, 4, 24},   // Thread 2: size 4, freq 24
-            {Queue(), 3, 6, 24},   // Thread 3: size 6, freq 24
-            {Queue(), 4, 8, 24}    // Thread 4: size 8, freq 24
-        };
-    } else if (exampleType == ExampleType::STARVED) {
-        // Starved example initialization
-        threads = {
-            {Queue(), 1, 1, 8},   // Thread 1: size 1, freq 8
-            {Queue(), 2, 3, 8},   // Thread 2: size 3, freq 8
-            {Queue(), 3, 2, 8},   // Thread 3: size 2, freq 8
-            {Queue(), 4, 8, 8}    // Thread 4: size 8, freq 8
-        };
+// Thread tables for the built-in examples, declared constexpr in StaticTaskSet.h
+vector<Thread> RoundRobinScheduler::exampleThreadSet(ExampleType exampleType) {
+    if (exampleType == ExampleType::STARVED) {
+        return vector<Thread>(roundRobinStarved.begin(), roundRobinStarved.end());
     }
+    return vector<Thread>(roundRobinStructured.begin(), roundRobinStructured.end());
+}
+
+// Constructor initializes threads and next release times based on example type
+RoundRobinScheduler::RoundRobinScheduler(ExampleType exampleType)
+    : RoundRobinScheduler(exampleThreadSet(exampleType)) {}
+
+// Constructor initializes threads and next release times from a loaded thread set
+RoundRobinScheduler::RoundRobinScheduler(const vector<Thread>& threadSet) : currentThreadIndex(0), timeQuantum(4) {
+    threads.assign(threadSet);
 
     // Set initial next release times based on the threads' frequencies
-    for (const Thread& thread : threads) {
-        nextReleaseTimes.push_back(thread.frequency);
+    for (int frequency : threads.frequencies) {
+        nextReleaseTimes.push_back(frequency);
     }
 }
 
-// Main scheduler loop with scrolling thread status display
+// Example run with the scrolling thread status display
 void RoundRobinScheduler::runExample() {
-    const int frameBoundary = 24;   
-    const int timeQuantum = 4;
-    int currentQuantum = 0;
+    runTicks(10008, OutputLevel::TIMELINE);
+}
+
+// Run for any horizon, printing as much as the output level asks for
+void RoundRobinScheduler::run(long long horizon, OutputLevel output) {
+    if (output == OutputLevel::TIMELINE || output == OutputLevel::LATENCY || trace != nullptr || arrivals != nullptr) {
+        runTicks(horizon, output);
+        return;
+    }
+
+    SimulationStats stats = simulate(horizon);
+    if (output == OutputLevel::SUMMARY) {
+        cout << "Total tasks created: " << stats.tasksCreated << endl;
+        cout << "Total tasks serviced: " << stats.tasksServiced << endl;
+        reportSwitches(stats.contextSwitches, stats.preemptions, stats.overheadTicks, stats.tasksServiced, horizon);
+    }
+}
+
+// Record every tick of later runs to a trace, nullptr stops recording
+void RoundRobinScheduler::setTrace(TraceWriter* traceWriter) {
+    trace = traceWriter;
+}
+
+// Take releases from an arrival trace in later runs, which then go tick by tick
+void RoundRobinScheduler::setArrivals(ArrivalSource* source) {
+    arrivals = source;
+}
+
+// Change how many ticks a thread may run before it is preempted
+void RoundRobinScheduler::setTimeQuantum(int quantum) {
+    timeQuantum = max(quantum, 1);
+}
+
+// Switches cost nothing until this is called
+void RoundRobinScheduler::setSwitchCosts(const SwitchCosts& costs) {
+    switchCosts.switchTicks = max(costs.switchTicks, 0);
+    switchCosts.refillTicks = max(costs.refillTicks, 0);
+}
+
+// Adaptive runs start every estimate over, so each run learns its thread set's sizes by itself
+void RoundRobinScheduler::setAdaptiveQuantum(bool adaptive) {
+    adaptiveQuantum = adaptive;
+}
+
+// Moving average with weight 1/8 on the newest size, the first size is taken as is
+void RoundRobinScheduler::noteDemand(size_t threadIndex, int requested) {
+    int& estimate = demandEstimates[threadIndex];
+    int sample = min(requested, adaptiveQuantumLimit) * 16;
+    estimate = (estimate == 0) ? sample : estimate + (sample - estimate) / 8;
+}
+
+// An adaptive turn is long enough for a typical task of the thread to finish without being preempted
+int RoundRobinScheduler::quantumFor(size_t threadIndex) const {
+    if (!adaptiveQuantum) {
+        return timeQuantum;
+    }
+    return max((demandEstimates[threadIndex] + 15) / 16, 1);
+}
+
+const vector<ThreadLatency>& RoundRobinScheduler::latencies() const {
+    return tickLatencies;
+}
+
+// Release a task for the thread at every multiple of its frequency
+int RoundRobinScheduler::releaseTick(size_t threadIndex, long long time) {
+    if (threadIndex == 0) {
+        releases.advance();  // Every thread's countdown at once, in place of a modulo per thread
+    }
+    if (!releases.isReleased(threadIndex)) {
+        return 0;
+    }
+    addTask(threadIndex, time);
+    return 1;
+}
 
-    int taskCounter = 0;
-    int servicedCounter = 0;
+// Every thread has its own queue
+size_t RoundRobinScheduler::releaseQueue(size_t threadIndex) {
+    return threadIndex;
+}
 
-    int timeCounter = 0;
-    while (timeCounter < 10008) {
-        if (timeCounter % frameBoundary == 0) {
-            setColor(COLOR_WHITE);
-            cout << "█▓▒░█▓▒░█▓▒░█▓▒░ | New Frame\n";
+// Release the thread's arrivals from the source instead
+int RoundRobinScheduler::releaseArrivals(size_t threadIndex, long long time) {
+    if (threadIndex == 0) {
+        arrivalBatch.collect(*arrivals, time, threads.count());
+    }
+    int released = 0;
+    Arrival arrival;
+    while (arrivalBatch.next(threadIndex, arrival)) {
+        threads.taskQueues[threadIndex].push(Task(arrival.size, time));
+        if (adaptiveQuantum) {
+            noteDemand(threadIndex, arrival.size);
         }
+        released++;
+    }
+    return released;
+}
 
-        // Track which threads have new tasks created in this time unit
-        vector<bool> taskCreated(threads.size(), false);
+// Move the cursor to the next thread with a task, it stays put if no thread has one
+TickSelection RoundRobinScheduler::selectTick() {
+    size_t checkedThreads = 0;
+    bool taskExists = false;
 
-        // Add tasks based on release times
-        for (size_t i = 0; i < threads.size(); ++i) {
-            if (timeCounter % threads[i].frequency == 0) {
-                addTask(i);  // Pass thread index
-                taskCounter++;
-                taskCreated[i] = true;  // Mark that a task was created for this thread
-            }
+    while (checkedThreads < threads.count()) {
+        taskExists = !threads.taskQueues[currentThreadIndex].isEmpty();
+        if (taskExists) {
+            break;  // Found a thread with tasks
         }
+        currentThreadIndex = (currentThreadIndex + 1) % threads.count();
+        checkedThreads++;
+    }
+    return {static_cast<int>(currentThreadIndex), taskExists};
+}
 
-        size_t checkedThreads = 0;
-        bool taskExists = false;
+TickCell RoundRobinScheduler::tickCell(size_t threadIndex, TickSelection selection, bool created) {
+    bool isRunning = (static_cast<int>(threadIndex) == selection.thread);
+    bool hasTask = !threads.taskQueues[threadIndex].isEmpty();
 
-        // Find the next thread with a task
-        while (checkedThreads < threads.size()) {
-            Thread& currentThread = threads[currentThreadIndex];
-            taskExists = !currentThread.taskQueue.isEmpty();
+    if (isRunning && created && hasTask) {
+        // Turquoise if a task is both created and executed in this time unit
+        return {&COLOR_TURQUOISE, "█▓▒░"};
+    } else if (isRunning && hasTask) {
+        // Green if this thread is currently running a task
+        return {&COLOR_GREEN, "█▓▒░"};
+    } else if (isRunning) {
+        // Orange if this thread is selected but has no task (idle)
+        return {&COLOR_ORANGE, "█▓▒░"};
+    } else if (created) {
+        // Yellow if a task is created but not running
+        return {&COLOR_YELLOW, "█▓▒░"};
+    } else if (hasTask) {
+        // Red for other threads with tasks waiting but not running
+        return {&COLOR_RED, "█▓▒░"};
+    }
+    // Gray if no tasks are in the queue or the thread isn't active
+    return {&COLOR_GRAY, "░░░░"};
+}
 
-            if (taskExists) {
-                break;  // Found a thread with tasks
-            } else {
-                // Color it orange in display logic
-                // Move to next thread
-                currentThreadIndex = (currentThreadIndex + 1) % threads.size();
-                checkedThreads++;
+// Service the selected thread for one tick and move the cursor on, true if its task finished
+bool RoundRobinScheduler::serviceTick(TickSelection selection, long long time) {
+    if (!selection.hasTask) {
+        // No task exists in the current thread, move to next thread
+        // No need to reset the quantum here
+        currentThreadIndex = (currentThreadIndex + 1) % threads.count();
+        return false;
+    }
+
+    TaskQueue& currentQueue = threads.taskQueues[currentThreadIndex];
+    Task* currentTask = currentQueue.top();
+    if (currentTask->getFirstRunTick() < 0) {
+        currentTask->setFirstRunTick(time);
+    }
+
+    // Execute the task
+    incrementCurrentTask(currentThreadIndex);
+    tickQuantum++;
+
+    // Check if the task is complete, it was due when its thread next released
+    if (currentTask->getServiced() == currentTask->getRequested()) {
+        currentTask->setCompletionTick(time + 1);
+        tickLatencies[currentThreadIndex].record(*currentTask,
+                                                 currentTask->getReleaseTick() + threads.frequencies[currentThreadIndex]);
+        currentQueue.pop();
+        // Move to next thread and reset quantum
+        currentThreadIndex = (currentThreadIndex + 1) % threads.count();
+        tickQuantum = 0;
+        return true;
+    }
+    if (tickQuantum >= quantumFor(currentThreadIndex)) {
+        // Time quantum expired, preempt and move to next thread
+        currentThreadIndex = (currentThreadIndex + 1) % threads.count();
+        tickQuantum = 0;
+    }
+    return false;
+}
+
+// Main scheduler loop with scrolling thread status display
+TickTotals RoundRobinScheduler::runTicks(long long horizon, OutputLevel output) {
+    tickQuantum = 0;
+    demandEstimates.assign(threads.count(), 0);
+    tickLatencies.assign(threads.count(), ThreadLatency(horizon));
+    releases.reset(threads.frequencies);
+
+    TickTotals totals;
+    if (arrivals != nullptr) {
+        totals = replayTicks(horizon, output);
+    } else if (output == OutputLevel::TIMELINE) {
+        AsyncTimelineRenderer renderer;  // Draws on its own thread, so a slow terminal doesn't hold up the run
+        totals = runTickEngine(*this, renderer, threads.count(), horizon, trace, switchCosts);
+    } else {
+        NullRenderer renderer;
+        totals = runTickEngine(*this, renderer, threads.count(), horizon, trace, switchCosts);
+    }
+    recordUnfinished(horizon);
+    reportTicks(totals, horizon, output);
+    return totals;
+}
+
+// Kept apart from runTicks so the periodic loop there stays small enough to inline its hooks
+TickTotals RoundRobinScheduler::replayTicks(long long horizon, OutputLevel output) {
+    ArrivalReleases<RoundRobinScheduler> replay(*this);
+    if (output == OutputLevel::TIMELINE) {
+        AsyncTimelineRenderer renderer;
+        return runTickEngine(replay, renderer, threads.count(), horizon, trace, switchCosts);
+    }
+    NullRenderer renderer;
+    return runTickEngine(replay, renderer, threads.count(), horizon, trace, switchCosts);
+}
+
+// Each queued task was due when its thread next released after it
+void RoundRobinScheduler::recordUnfinished(long long horizon) {
+    for (size_t i = 0; i < threads.count(); ++i) {
+        forEachQueued(threads.taskQueues[i], [&](Task& task) {
+            tickLatencies[i].recordUnfinished(task.getReleaseTick() + threads.frequencies[i], horizon);
+        });
+    }
+}
+
+void RoundRobinScheduler::reportTicks(const TickTotals& totals, long long horizon, OutputLevel output) {
+    if (output != OutputLevel::NONE) {
+        cout << "Total tasks created: " << totals.tasksCreated << endl;
+        cout << "Total tasks serviced: " << totals.tasksServiced << endl;
+        reportSwitches(totals.contextSwitches, totals.preemptions, totals.overheadTicks, totals.tasksServiced, horizon);
+        if (arrivals != nullptr && arrivalBatch.ignored() > 0) {
+            cout << "Arrivals for threads not in the set: " << arrivalBatch.ignored() << endl;
+        }
+    }
+    if (output == OutputLevel::TIMELINE || output == OutputLevel::LATENCY) {
+        printLatencyReport(tickLatencies);
+    }
+}
+
+void RoundRobinScheduler::reportSwitches(long long switches, long long preemptions, long long overheadTicks,
+                                         long long serviced, long long horizon) {
+    cout << "Context switches: " << switches << endl;
+    cout << "Preemptions: " << preemptions << endl;
+    if (switchCosts.any() && horizon > 0) {
+        cout << "Switch overhead: " << overheadTicks << " time units (" << 100.0 * overheadTicks / horizon << "%)" << endl;
+        cout << "Throughput: " << 1000.0 * serviced / horizon << " tasks per 1000 time units" << endl;
+    }
+}
+
+// Event-driven scheduler loop, jumps to the next release, task completion or quantum expiry
+// Gives the same totals as runTicks over the same horizon, without the display
+SimulationStats RoundRobinScheduler::simulate(long long horizon) {
+    SimulationStats stats = {0, 0, 0, 0, 0, 0, 0, 0};
+    int currentQuantum = 0;
+    SwitchTracker switches;
+    demandEstimates.assign(threads.count(), 0);
+
+    // Round robin releases at every multiple of the frequency, starting at time zero
+    // A periodic thread's estimate is its size from its first release on, before it ever runs,
+    // so adaptive runs repeat each hyperperiod the same way
+    vector<long long> releaseTimes(threads.count(), 0);
+    SteadyStateDetector steadyState;
+    steadyState.start(threads, horizon, 0);
+
+    long long timeCounter = 0;
+    long long nextRelease = 0;
+    while (timeCounter < horizon) {
+        // Once a hyperperiod repeats, every remaining whole one plays out the same way
+        if (timeCounter == steadyState.nextBoundary() &&
+            steadyState.atBoundary(threads, stats, currentThreadIndex, currentQuantum, switches)) {
+            long long periods = (horizon - timeCounter) / steadyState.period();
+            long long skipped = periods * steadyState.period();
+            stats.tasksCreated += periods * steadyState.growthPerPeriod().tasksCreated;
+            stats.tasksServiced += periods * steadyState.growthPerPeriod().tasksServiced;
+            stats.contextSwitches += periods * steadyState.growthPerPeriod().contextSwitches;
+            stats.preemptions += periods * steadyState.growthPerPeriod().preemptions;
+            stats.overheadTicks += periods * steadyState.growthPerPeriod().overheadTicks;
+            stats.extrapolatedTicks = skipped;
+            for (long long& releaseTime : releaseTimes) {
+                releaseTime += skipped;
             }
+            timeCounter += skipped;
+            steadyState.stop();
+            continue;
         }
 
-        // If no threads have tasks, we can idle or continue
-        if (checkedThreads == threads.size() && !taskExists) {
-            // All threads are empty; you may choose to idle here
-            // For now, we'll proceed to display and increment timeCounter
+        // Add tasks based on release times and find the next release, only when one is due
+        if (timeCounter >= nextRelease) {
+            nextRelease = horizon;
+            for (size_t i = 0; i < threads.count(); ++i) {
+                if (timeCounter == releaseTimes[i]) {
+                    addTask(i, timeCounter);
+                    releaseTimes[i] += threads.frequencies[i];
+                    stats.tasksCreated++;
+                }
+                nextRelease = min(nextRelease, releaseTimes[i]);
+            }
         }
 
-        // Display thread statuses
-        for (size_t i = 0; i < threads.size(); ++i) {
-            bool isRunning = (i == currentThreadIndex);
-            bool isCreated = taskCreated[i];
-            bool hasTask = !threads[i].taskQueue.isEmpty();
-
-            if (isRunning && isCreated && hasTask) {
-                // Turquoise if a task is both created and executed in this time unit
-                setColor(COLOR_TURQUOISE);
-                cout << "█▓▒░";
-            } else if (isRunning && hasTask) {
-                // Green if this thread is currently running a task
-                setColor(COLOR_GREEN);
-                cout << "█▓▒░";
-            } else if (isRunning && !hasTask) {
-                // Orange if this thread is selected but has no task (idle)
-                setColor(COLOR_ORANGE);
-                cout << "█▓▒░";
-            } else if (isCreated && !isRunning) {
-                // Yellow if a task is created but not running
-                setColor(COLOR_YELLOW);
-                cout << "█▓▒░";
-            } else if (hasTask) {
-                // Red for other threads with tasks waiting but not running
-                setColor(COLOR_RED);
-                cout << "█▓▒░";
-            } else {
-                // Gray if no tasks are in the queue or the thread isn't active
-                setColor(COLOR_GRAY);
-                cout << "░░░░";
+        // Find the next thread with a task
+        size_t checkedThreads = 0;
+        bool taskExists = false;
+        while (checkedThreads < threads.count()) {
+            taskExists = !threads.taskQueues[currentThreadIndex].isEmpty();
+            if (taskExists) {
+                break;
             }
+            currentThreadIndex = (currentThreadIndex + 1) % threads.count();
+            checkedThreads++;
         }
-        setColor(COLOR_WHITE);
-        cout << " | " << timeCounter + 1 << endl;
 
-        // If there is a task to execute
-        if (taskExists) {
-            // Execute the task
-            incrementCurrentTask(currentThreadIndex);
-            currentQuantum++;  // Increment quantum time
-
-            // Check if the task is complete
-            Thread& currentThread = threads[currentThreadIndex];
-            Task* currentTask = currentThread.taskQueue.top();
-            if (currentTask->getServiced() == currentTask->getRequested()) {
-                currentThread.taskQueue.pop();
-                servicedCounter++;
-                // Move to next thread and reset quantum
-                currentThreadIndex = (currentThreadIndex + 1) % threads.size();
+        long long step = nextRelease - timeCounter;
+        int overhead = (taskExists && switchCosts.any())
+                           ? switches.overheadBefore(static_cast<int>(currentThreadIndex), switchCosts) : 0;
+        if (overhead > 0) {
+            // Switching to the thread, it keeps its turn and nothing runs until the switch is paid or a release
+            step = min(step, static_cast<long long>(overhead));
+            switches.overheadLeft -= static_cast<int>(step);
+            stats.overheadTicks += step;
+        } else if (taskExists) {
+            // The current thread runs until a release, its task finishes or its quantum expires
+            // An adaptive quantum can shrink below the ticks already run, the thread then gets one more
+            TaskQueue& currentQueue = threads.taskQueues[currentThreadIndex];
+            Task* currentTask = currentQueue.top();
+            int quantum = quantumFor(currentThreadIndex);
+            step = min(step, static_cast<long long>(currentTask->getRequested() - currentTask->getServiced()));
+            step = min(step, static_cast<long long>(max(quantum - currentQuantum, 1)));
+
+            currentTask->setServiced(currentTask->getServiced() + static_cast<int>(step));
+            currentQuantum += static_cast<int>(step);
+
+            bool finished = currentTask->getServiced() == currentTask->getRequested();
+            switches.record(static_cast<int>(currentThreadIndex), finished, stats.contextSwitches, stats.preemptions);
+            if (finished) {
+                currentQueue.pop();
+                stats.tasksServiced++;
+                currentThreadIndex = (currentThreadIndex + 1) % threads.count();
                 currentQuantum = 0;
-            } else if (currentQuantum >= timeQuantum) {
-                // Time quantum expired, preempt and move to next thread
-                currentThreadIndex = (currentThreadIndex + 1) % threads.size();
+            } else if (currentQuantum >= quantum) {
+                currentThreadIndex = (currentThreadIndex + 1) % threads.count();
                 currentQuantum = 0;
             }
         } else {
-            // No task exists in the current thread, move to next thread
-            currentThreadIndex = (currentThreadIndex + 1) % threads.size();
-            // No need to reset currentQuantum here
+            // Every queue is empty, the idle selection advances one thread per tick
+            currentThreadIndex = (currentThreadIndex + static_cast<size_t>(step % static_cast<long long>(threads.count()))) % threads.count();
         }
 
-        timeCounter++;
+        timeCounter += step;
     }
 
-    cout << "Total tasks created: " << taskCounter << endl;
-    cout << "Total tasks serviced: " << servicedCounter << endl;
+    return stats;
 }
 
 // Add a new task to the specified thread's queue
-void RoundRobinScheduler::addTask(size_t threadIndex) {
+void RoundRobinScheduler::addTask(size_t threadIndex, long long releaseTick) {
     // Get the thread by index and push a task to its queue
-    Thread& thread = threads[threadIndex];
-    int requestedTime = thread.size;  // Use the thread's size as the requested time for the task
-    thread.taskQueue.push(Task(requestedTime));
+    int requestedTime = threads.sizes[threadIndex];  // Use the thread's size as the requested time for the task
+    threads.taskQueues[threadIndex].push(Task(requestedTime, releaseTick));
+    if (adaptiveQuantum) {
+        noteDemand(threadIndex, requestedTime);
+    }
 }
 
 // Increment the `serviced` field of the task in the specified thread
 void RoundRobinScheduler::incrementCurrentTask(size_t index) {
     // Get the thread by index and increment its top task if it has one
-    if (!threads[index].taskQueue.isEmpty()) {
-        Task* topTask = threads[index].taskQueue.top();
+    if (!threads.taskQueues[index].isEmpty()) {
+        Task* topTask = threads.taskQueues[index].top();
         topTask->setServiced(topTask->getServiced() + 1);
     }
 }
 
 // Destructor to clear the queues in each thread
 RoundRobinScheduler::~RoundRobinScheduler() {
-    for (Thread& thread : threads) {
-        while (!thread.taskQueue.isEmpty()) {
-            thread.taskQueue.pop();
+    for (TaskQueue& taskQueue : threads.taskQueues) {
+        while (!taskQueue.isEmpty()) {
+            taskQueue.pop();
         }
     }
 }
\ No newline at end of file
@@ -4,37 +4,88 @@
  * @brief Contains the round robin class definitions
  * 
  * Contains the definition of the round robin class and the node struct.
- * Creates 4 threads using "Queues" to simulate a round robin scheduler.
+ * Creates a table of threads using "Queues" to simulate a round robin scheduler.
  * 
  * @date 11/5/24
  * @author Fiya Clerget, Marcello Novak
  */
 
+#include "ArrivalTrace.h"
+#include "LatencyHistogram.h"
+#include "OutputLevel.h"
 #include "Queue.h"
 #include "SchedulerCommon.h"
+#include "ScheduleTrace.h"
 #include "RateMonotonic.h"
+#include "ReleaseCountdown.h"
 #include "Task.h"
+#include "TickEngine.h"
 #include <vector>
 #include <iostream>
 using namespace std;
 
 class RoundRobinScheduler {
     protected:
-        vector<Thread> threads;       // Stores each thread with its queue, frequency, and ID
-        vector<int> nextReleaseTimes; // Tracks the next release time for each thread
+        ThreadTable threads;          // Stores each thread's queue, size, and frequency
+        vector<long long> nextReleaseTimes; // Tracks the next release time for each thread
 
-        void addTask(unsigned long long threadIndex);
-        void incrementCurrentTask(unsigned long long index);
+        void addTask(size_t threadIndex, long long releaseTick);
+        void incrementCurrentTask(size_t index);
 
-        unsigned long long currentThreadIndex = 0;  // Index of the current thread being serviced
-    public:
-        enum class ExampleType { STRUCTURED, STARVED };
+        size_t currentThreadIndex = 0;  // Index of the current thread being serviced
+        int timeQuantum = 4;            // Ticks a thread may run before it is preempted
+        bool adaptiveQuantum = false;   // Size each thread's quantum from its demand estimate instead
+        vector<int> demandEstimates;    // Moving average of each thread's task sizes in sixteenths of a tick, 0 before any
+        void noteDemand(size_t threadIndex, int requested);  // Fold a released task's size into the estimate
+        int quantumFor(size_t threadIndex) const;           // timeQuantum, or the thread's estimate when adaptive
+        TraceWriter* trace = nullptr;   // Receives every tick of tick by tick runs when set
+        SwitchCosts switchCosts;        // Ticks lost whenever a different thread gets the CPU, free by default
+        ArrivalSource* arrivals = nullptr;  // Replaces the periodic releases in tick by tick runs when set
+        ArrivalBatch arrivalBatch;          // Arrivals due this tick
+        ReleaseCountdown releases;          // Periodic releases of tick by tick runs, counted down for all threads at once
+
+        int tickQuantum = 0;                  // Ticks the current thread has run this turn, in tick by tick runs
+        vector<ThreadLatency> tickLatencies;  // Latencies of the current tick by tick run
+        void recordUnfinished(long long horizon);  // Add the tasks still queued at the horizon to tickLatencies
+        void reportTicks(const TickTotals& totals, long long horizon, OutputLevel output);  // Totals and latencies at the end of runTicks
+        void reportSwitches(long long switches, long long preemptions, long long overheadTicks, long long serviced,
+                            long long horizon);  // Switch counts, and the overhead and throughput when switches cost
 
-        // Constructor and Destructor
+        // Tick engine hooks, see TickEngine.h
+        int releaseTick(size_t threadIndex, long long time);
+        int releaseArrivals(size_t threadIndex, long long time);
+        size_t releaseQueue(size_t threadIndex);
+        TickSelection selectTick();
+        TickCell tickCell(size_t threadIndex, TickSelection selection, bool created);
+        bool serviceTick(TickSelection selection, long long time);
+
+        template <typename Policy, typename Renderer>
+        friend TickTotals runTickEngine(Policy& policy, Renderer& renderer, size_t threadCount, long long horizon,
+                                        TraceWriter* trace, const SwitchCosts& costs);
+        template <typename Policy>
+        friend class ArrivalReleases;
+        TickTotals replayTicks(long long horizon, OutputLevel output);  // runTicks with the releases from arrivals
+    public:
+        // Constructors and Destructor
         RoundRobinScheduler(ExampleType exampleType);
+        RoundRobinScheduler(const vector<Thread>& threadSet);
         ~RoundRobinScheduler();
 
-        // Function to run the example
+        static vector<Thread> exampleThreadSet(ExampleType exampleType);
+
+        // Functions to run the example
         void runExample();
+        void run(long long horizon, OutputLevel output);  // Timeline, traced or replayed runs go tick by tick, otherwise event-driven
+        TickTotals runTicks(long long horizon, OutputLevel output);  // Tick by tick run, with the status display at timeline output
+        SimulationStats simulate(long long horizon);      // Event-driven run with no display
+        void setTrace(TraceWriter* traceWriter);
+        void setArrivals(ArrivalSource* source);  // Release tasks from source instead of the frequencies, nullptr goes back
+        void setTimeQuantum(int quantum);  // Ticks per turn for later runs, at least 1
+        void setAdaptiveQuantum(bool adaptive);  // Give each thread about its estimated task size per turn
+        void setSwitchCosts(const SwitchCosts& costs);  // Charge every context switch in later runs
+
+        static constexpr int adaptiveQuantumLimit = 64;  // Longest adaptive turn, so one long task can't hold the CPU
+
+        const vector<ThreadLatency>& latencies() const;  // Of the last tick by tick run
 
 };
@@ -0,0 +1,208 @@
+/**
+ * @file Runtime.cpp
+ * @brief Periodic runtime implementation.
+ *
+ * The calling thread releases jobs on schedule, worker threads run them.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "Runtime.h"
+#include "DaryHeap.h"
+#include <algorithm>  // For max, min, sort
+#include <cmath>      // For sqrt
+#include <iostream>
+#include <thread>
+#include <utility>    // For pair
+
+using namespace std;
+
+PeriodicRuntime::PeriodicRuntime(const vector<Thread>& threadSet, CorePolicy corePolicy, unsigned workerCount)
+    : threads(threadSet), work(threadSet.size()), policy(corePolicy), pending(0), releasing(false), sleepers(0) {
+    if (workerCount == 0) {
+        workerCount = max(1u, thread::hardware_concurrency());
+    }
+    workers.resize(workerCount);
+    assignLanes();
+}
+
+// Rate monotonic spreads the distinct priorities over up to maxLanes bands, round robin has one FIFO lane
+void PeriodicRuntime::assignLanes() {
+    size_t laneCount = 1;
+    threadLane.assign(threads.size(), 0);
+    if (policy == CorePolicy::RATE_MONOTONIC) {
+        vector<int> priorities;
+        for (const Thread& thread : threads) {
+            priorities.push_back(thread.priority);
+        }
+        sort(priorities.begin(), priorities.end());
+        priorities.erase(unique(priorities.begin(), priorities.end()), priorities.end());
+
+        laneCount = max<size_t>(1, min(maxLanes, priorities.size()));
+        for (size_t i = 0; i < threads.size(); ++i) {
+            size_t rank = static_cast<size_t>(lower_bound(priorities.begin(), priorities.end(), threads[i].priority) -
+                                              priorities.begin());
+            threadLane[i] = rank * laneCount / priorities.size();
+        }
+    }
+
+    for (Worker& worker : workers) {
+        worker.lanes.clear();
+        for (size_t lane = 0; lane < laneCount; ++lane) {
+            worker.lanes.emplace_back(new MpmcQueue<Job>(laneCapacity));
+        }
+    }
+}
+
+void PeriodicRuntime::bind(size_t threadIndex, function<void()> callable) {
+    if (threadIndex < work.size()) {
+        work[threadIndex] = move(callable);
+    }
+}
+
+size_t PeriodicRuntime::workerCount() const {
+    return workers.size();
+}
+
+// Highest band first, from the worker's own lane and then from the others
+bool PeriodicRuntime::takeJob(size_t workerIndex, Job& job) {
+    Worker& self = workers[workerIndex];
+    for (size_t lane = 0; lane < self.lanes.size(); ++lane) {
+        for (size_t offset = 0; offset < workers.size(); ++offset) {
+            size_t victim = (workerIndex + offset) % workers.size();
+            if (workers[victim].lanes[lane]->tryPop(job)) {
+                pending.fetch_sub(1);
+                if (offset != 0) {
+                    self.steals++;
+                }
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Run jobs until releasing has stopped and every job is taken, parking while there is nothing to do
+void PeriodicRuntime::workerLoop(size_t workerIndex) {
+    Worker& self = workers[workerIndex];
+    Job job;
+    for (;;) {
+        if (takeJob(workerIndex, job)) {
+            auto start = chrono::steady_clock::now();
+            self.latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(start - job.release).count());
+            if (work[job.threadIndex]) {
+                work[job.threadIndex]();
+            }
+            continue;
+        }
+        if (!releasing.load() && pending.load() == 0) {
+            return;
+        }
+
+        // The timeout covers a release that lands between the check and the wait
+        unique_lock<mutex> lock(parkMutex);
+        sleepers.fetch_add(1);
+        parkSignal.wait_for(lock, chrono::milliseconds(1), [this]() { return pending.load() > 0 || !releasing.load(); });
+        sleepers.fetch_sub(1);
+    }
+}
+
+RuntimeStats PeriodicRuntime::run(long long horizon, chrono::nanoseconds tick) {
+    RuntimeStats stats = {0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    for (Worker& worker : workers) {
+        worker.latencies.clear();
+        worker.steals = 0;
+    }
+    pending.store(0);
+    releasing.store(true);
+
+    vector<thread> pool;
+    for (size_t i = 0; i < workers.size(); ++i) {
+        pool.emplace_back(&PeriodicRuntime::workerLoop, this, i);
+    }
+
+    // Next release tick of every thread, rate monotonic first releases at one period and round robin at zero
+    DaryHeap<pair<long long, size_t>> releases;  // Earliest release first
+    for (size_t i = 0; i < threads.size(); ++i) {
+        releases.push({policy == CorePolicy::RATE_MONOTONIC ? threads[i].frequency : 0, i});
+    }
+
+    auto start = chrono::steady_clock::now();
+    while (!releases.isEmpty() && releases.top().first < horizon) {
+        long long releaseTick = releases.top().first;
+        auto releaseTime = start + releaseTick * tick;
+        this_thread::sleep_until(releaseTime);
+
+        // Every thread due at this tick goes to its home worker's lane for its band
+        while (!releases.isEmpty() && releases.top().first == releaseTick) {
+            size_t threadIndex = releases.top().second;
+            releases.replaceTop({releaseTick + threads[threadIndex].frequency, threadIndex});
+
+            Worker& home = workers[threadIndex % workers.size()];
+            pending.fetch_add(1);
+            if (home.lanes[threadLane[threadIndex]]->tryPush({threadIndex, releaseTime})) {
+                stats.jobsReleased++;
+            } else {
+                pending.fetch_sub(1);
+                stats.jobsDropped++;
+            }
+        }
+        if (sleepers.load() > 0) {
+            lock_guard<mutex> lock(parkMutex);
+            parkSignal.notify_all();
+        }
+    }
+
+    releasing.store(false);
+    {
+        lock_guard<mutex> lock(parkMutex);
+        parkSignal.notify_all();
+    }
+    for (thread& worker : pool) {
+        worker.join();
+    }
+    stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<long long> latencies;
+    for (Worker& worker : workers) {
+        latencies.insert(latencies.end(), worker.latencies.begin(), worker.latencies.end());
+        stats.steals += worker.steals;
+    }
+    stats.jobsCompleted = static_cast<long long>(latencies.size());
+    if (latencies.empty()) {
+        return stats;
+    }
+
+    sort(latencies.begin(), latencies.end());
+    double sum = 0.0;
+    double squares = 0.0;
+    for (long long latency : latencies) {
+        sum += latency;
+        squares += static_cast<double>(latency) * latency;
+    }
+    double count = static_cast<double>(latencies.size());
+    double mean = sum / count;
+    stats.meanLatencyMicros = mean / 1000.0;
+    stats.jitterMicros = sqrt(max(0.0, squares / count - mean * mean)) / 1000.0;
+    stats.p50LatencyMicros = latencies[latencies.size() / 2] / 1000.0;
+    stats.p99LatencyMicros = latencies[min(latencies.size() - 1, latencies.size() * 99 / 100)] / 1000.0;
+    stats.maxLatencyMicros = latencies.back() / 1000.0;
+    return stats;
+}
+
+void spinFor(chrono::nanoseconds duration) {
+    auto end = chrono::steady_clock::now() + duration;
+    while (chrono::steady_clock::now() < end) {
+    }
+}
+
+void printRuntimeStats(const RuntimeStats& stats, size_t workerCount) {
+    cout << "Jobs released: " << stats.jobsReleased << ", completed: " << stats.jobsCompleted
+         << ", dropped: " << stats.jobsDropped << endl;
+    cout << "Workers: " << workerCount << ", steals: " << stats.steals << endl;
+    cout << "Throughput: " << (stats.seconds > 0 ? stats.jobsCompleted / stats.seconds : 0.0) << " jobs/s over "
+         << stats.seconds << " s" << endl;
+    cout << "Dispatch latency (us): mean " << stats.meanLatencyMicros << ", p50 " << stats.p50LatencyMicros << ", p99 "
+         << stats.p99LatencyMicros << ", max " << stats.maxLatencyMicros << ", jitter " << stats.jitterMicros << endl;
+}
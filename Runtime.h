@@ -0,0 +1,89 @@
+/**
+ * @file Runtime.h
+ * @brief Contains the periodic runtime class definition
+ *
+ * Runs real work instead of simulating it. Each thread of a thread set is
+ * bound to a callable that is released every frequency ticks against the
+ * steady clock, and a pool of worker OS threads runs the released jobs.
+ *
+ * Every worker owns lock-free lanes, one per priority band for rate
+ * monotonic and a single FIFO lane for round robin. Workers take the highest
+ * band with work, their own lane first and then stealing from the others.
+ * Jobs run to completion, a callable is never preempted.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "MpmcQueue.h"
+#include "SchedulerCommon.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Totals and dispatch timing of a runtime run, latencies are release to start
+struct RuntimeStats {
+    long long jobsReleased;
+    long long jobsCompleted;
+    long long jobsDropped;  // Released while their lane was full
+    long long steals;       // Jobs a worker took from another worker's lanes
+    double seconds;         // Wall time from the first release until the last job finished
+    double meanLatencyMicros;
+    double jitterMicros;    // Standard deviation of the latency
+    double p50LatencyMicros;
+    double p99LatencyMicros;
+    double maxLatencyMicros;
+};
+
+class PeriodicRuntime {
+    private:
+        struct Job {
+            size_t threadIndex;
+            std::chrono::steady_clock::time_point release;
+        };
+
+        // Per worker lanes and counters, aligned so workers don't share cache lines
+        struct alignas(64) Worker {
+            std::vector<std::unique_ptr<MpmcQueue<Job>>> lanes;  // Highest priority band first
+            std::vector<long long> latencies;                     // Nanoseconds, one per job run
+            long long steals = 0;
+        };
+
+        std::vector<Thread> threads;
+        std::vector<std::function<void()>> work;  // Callable bound to each thread
+        std::vector<size_t> threadLane;           // Priority band of each thread
+        CorePolicy policy;
+        std::vector<Worker> workers;
+
+        std::atomic<long long> pending;   // Jobs pushed and not yet taken
+        std::atomic<bool> releasing;
+        std::atomic<int> sleepers;        // Workers parked waiting for work
+        std::mutex parkMutex;
+        std::condition_variable parkSignal;
+
+        void assignLanes();
+        bool takeJob(size_t workerIndex, Job& job);
+        void workerLoop(size_t workerIndex);
+    public:
+        static constexpr size_t maxLanes = 16;
+        static constexpr size_t laneCapacity = 4096;
+
+        // Constructor, workerCount 0 uses one worker per hardware thread
+        PeriodicRuntime(const std::vector<Thread>& threadSet, CorePolicy corePolicy, unsigned workerCount);
+
+        void bind(size_t threadIndex, std::function<void()> callable);
+        size_t workerCount() const;
+
+        // Release jobs for horizon ticks of tick length each, then wait for the workers to drain them
+        RuntimeStats run(long long horizon, std::chrono::nanoseconds tick);
+};
+
+// Busy work standing in for a task, spins for the given time
+void spinFor(std::chrono::nanoseconds duration);
+
+void printRuntimeStats(const RuntimeStats& stats, size_t workerCount);
@@ -0,0 +1,148 @@
+/**
+ * @file Schedulability.cpp
+ * @brief Rate monotonic schedulability analysis implementation.
+ *
+ * Response times come from the usual fixed point
+ * R = C + sum over higher priority threads of ceil(R / T) * C,
+ * stopped as soon as R passes the thread's own period.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "Schedulability.h"
+#include <algorithm>  // For sort
+#include <chrono>
+#include <cmath>      // For pow
+#include <iostream>
+#include <numeric>    // For iota
+
+// Give up and leave the set to the simulator past this many interference terms
+static const long long analysisBudget = 20000000;
+
+SchedulabilityReport analyzeRateMonotonic(const std::vector<Thread>& threadSet) {
+    auto start = std::chrono::steady_clock::now();
+    const size_t n = threadSet.size();
+
+    SchedulabilityReport report;
+    report.verdict = Schedulability::UNDECIDED;
+    report.decidedBy = "response time analysis";
+    report.utilization = 0;
+    report.utilizationBound = n == 0 ? 1.0 : n * (std::pow(2.0, 1.0 / n) - 1.0);
+    report.responseTimes.assign(n, 0);
+
+    // The scheduler picks the lowest priority value first, ties go to the lowest index
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return threadSet[a].priority < threadSet[b].priority; });
+
+    // Threads sharing a priority push tasks the size of the first one into its FIFO queue,
+    // each counts the others as interference and only a pass can be trusted
+    // The utilization bound only holds when shorter periods get higher priorities
+    std::vector<long long> sizes(n);
+    bool sharedPriorities = false;
+    bool rateMonotonicOrder = true;
+    for (size_t k = 0; k < n; ++k) {
+        bool shared = k > 0 && threadSet[order[k]].priority == threadSet[order[k - 1]].priority;
+        sizes[order[k]] = shared ? sizes[order[k - 1]] : threadSet[order[k]].size;
+        sharedPriorities = sharedPriorities || shared;
+        rateMonotonicOrder = rateMonotonicOrder && (k == 0 || threadSet[order[k]].frequency >= threadSet[order[k - 1]].frequency);
+        report.utilization += static_cast<double>(sizes[order[k]]) / threadSet[order[k]].frequency;
+    }
+
+    bool allMet = true;
+    bool outOfBudget = false;
+    long long work = 0;
+    for (size_t k = 0; k < n && !outOfBudget; ++k) {
+        const Thread& thread = threadSet[order[k]];
+        size_t interferers = k;
+        while (interferers + 1 < n && threadSet[order[interferers + 1]].priority == thread.priority) {
+            interferers++;  // Equal priority threads that come later still delay this one
+        }
+        if (interferers > k) {
+            interferers++;
+        }
+
+        long long response = sizes[order[k]];
+        for (;;) {
+            long long demand = sizes[order[k]];
+            for (size_t j = 0; j < interferers && demand <= thread.frequency; ++j) {
+                if (j == k) {
+                    continue;
+                }
+                const Thread& other = threadSet[order[j]];
+                demand += (response + other.frequency - 1) / other.frequency * sizes[order[j]];
+            }
+            work += static_cast<long long>(interferers);
+            if (demand == response || demand > thread.frequency) {
+                response = demand;
+                break;
+            }
+            if (work > analysisBudget) {
+                outOfBudget = true;
+                break;
+            }
+            response = demand;
+        }
+
+        if (outOfBudget) {
+            break;
+        }
+        if (response <= thread.frequency) {
+            report.responseTimes[order[k]] = response;
+        } else {
+            report.responseTimes[order[k]] = -1;
+            allMet = false;
+        }
+    }
+
+    if (n > 0 && rateMonotonicOrder && !sharedPriorities && report.utilization <= report.utilizationBound) {
+        report.verdict = Schedulability::SCHEDULABLE;
+        report.decidedBy = "Liu & Layland utilization bound";
+    } else if (report.utilization > 1.0) {
+        report.verdict = Schedulability::UNSCHEDULABLE;
+        report.decidedBy = "utilization above 1";
+    } else if (outOfBudget) {
+        report.verdict = Schedulability::UNDECIDED;
+        report.decidedBy = "response time analysis ran out of budget";
+    } else if (allMet) {
+        report.verdict = Schedulability::SCHEDULABLE;
+    } else if (!sharedPriorities) {
+        report.verdict = Schedulability::UNSCHEDULABLE;
+    } else {
+        report.verdict = Schedulability::UNDECIDED;
+        report.decidedBy = "response time analysis, inexact for shared priorities";
+    }
+
+    report.microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+void printSchedulabilityReport(const std::vector<Thread>& threadSet, const SchedulabilityReport& report) {
+    std::cout << "Utilization " << report.utilization << ", Liu & Layland bound " << report.utilizationBound
+              << " for " << threadSet.size() << " threads" << std::endl;
+
+    // Keep the table readable for generated sets
+    const size_t maxRows = 64;
+    std::cout << "thread priority size frequency response" << std::endl;
+    for (size_t i = 0; i < threadSet.size() && i < maxRows; ++i) {
+        std::cout << i + 1 << " " << threadSet[i].priority << " " << threadSet[i].size << " "
+                  << threadSet[i].frequency << " ";
+        if (report.responseTimes[i] > 0) {
+            std::cout << report.responseTimes[i] << std::endl;
+        } else if (report.responseTimes[i] < 0) {
+            std::cout << "past period" << std::endl;
+        } else {
+            std::cout << "not analyzed" << std::endl;
+        }
+    }
+    if (threadSet.size() > maxRows) {
+        std::cout << "... " << threadSet.size() - maxRows << " more threads" << std::endl;
+    }
+
+    const char* verdict = report.verdict == Schedulability::SCHEDULABLE     ? "Schedulable"
+                        : report.verdict == Schedulability::UNSCHEDULABLE ? "Not schedulable"
+                                                                           : "Undecided";
+    std::cout << verdict << " by " << report.decidedBy << " in " << report.microseconds << " us" << std::endl;
+}
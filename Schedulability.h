@@ -0,0 +1,34 @@
+/**
+ * @file Schedulability.h
+ * @brief Contains the rate monotonic schedulability analysis
+ *
+ * Decides from the thread table alone whether every task of a rate monotonic
+ * thread set finishes before its thread releases the next one.
+ * The Liu & Layland utilization bound is tried first when priorities follow
+ * the periods, then exact response time analysis. Threads release on multiples of their period, so all of them
+ * release together at every common multiple and the analysis' critical
+ * instant really happens in the simulator.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "SchedulerCommon.h"
+#include <vector>
+
+enum class Schedulability { SCHEDULABLE, UNSCHEDULABLE, UNDECIDED };
+
+struct SchedulabilityReport {
+    Schedulability verdict;
+    const char* decidedBy;             // Which test settled the verdict
+    double utilization;                // Sum of size / frequency, with the sizes the scheduler releases
+    double utilizationBound;           // Liu & Layland bound n(2^(1/n) - 1)
+    std::vector<long long> responseTimes;  // Worst case ticks from release to completion, -1 past the period, 0 not analyzed
+    double microseconds;               // Time the analysis took
+};
+
+// Analyze a thread set, sets it can't settle come back UNDECIDED for the simulator
+SchedulabilityReport analyzeRateMonotonic(const std::vector<Thread>& threadSet);
+
+void printSchedulabilityReport(const std::vector<Thread>& threadSet, const SchedulabilityReport& report);
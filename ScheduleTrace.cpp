@@ -0,0 +1,376 @@
+/**
+ * @file ScheduleTrace.cpp
+ * @brief Schedule trace writer and reader implementation.
+ *
+ * The writer buffers encoded ticks and writes them out in large chunks.
+ * The reader memory maps the trace and decodes ticks on demand,
+ * seeking through the block index so any tick is reached in constant time.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "ScheduleTrace.h"
+#include <algorithm>  // For is_sorted, sort
+#include <cstring>    // For memcmp
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char headerMagic[8] = {'S', 'C', 'H', 'T', 'R', 'A', 'C', 'E'};
+static const char footerMagic[8] = {'S', 'C', 'H', 'T', 'R', 'I', 'D', 'X'};
+static const uint32_t traceVersion = 1;
+static const size_t headerSize = 24;  // Magic, version, scheduler, thread count, block ticks
+static const size_t footerSize = 32;  // Index offset, block count, tick count, magic
+static const size_t writeChunk = 1 << 20;
+
+enum TickFlags { EXECUTED = 1, COMPLETED = 2, PREEMPTED = 4 };
+
+// Little-endian fixed width value stored in the header, index and footer
+static uint64_t readFixed(const uint8_t* bytes, int count) {
+    uint64_t value = 0;
+    for (int i = count - 1; i >= 0; --i) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+// Signed deltas are zigzag encoded so small negative steps stay one byte
+static uint64_t zigzagEncode(long long value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+static long long zigzagDecode(uint64_t value) {
+    return static_cast<long long>(value >> 1) ^ -static_cast<long long>(value & 1);
+}
+
+// Constructor and Destructor
+TraceWriter::TraceWriter()
+    : file(nullptr), fileOffset(0), tickCount(0), previousRunning(-1), failed(false) {}
+
+TraceWriter::~TraceWriter() {
+    if (isOpen()) {
+        close();
+    }
+}
+
+// Create the file and write the header, printing the problem if it can't be created
+bool TraceWriter::open(const std::string& path, TraceScheduler scheduler, size_t threadCount) {
+    file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        printf("Could not create trace file %s\n", path.c_str());
+        return false;
+    }
+
+    buffer.clear();
+    buffer.reserve(writeChunk + 1024);
+    blockOffsets.clear();
+    pendingCounts.assign(threadCount, 0);
+    tickReleases.clear();
+    fileOffset = 0;
+    tickCount = 0;
+    previousRunning = -1;
+    failed = false;
+
+    buffer.insert(buffer.end(), headerMagic, headerMagic + 8);
+    putFixed(traceVersion, 4);
+    putFixed(static_cast<uint32_t>(scheduler), 4);
+    putFixed(threadCount, 4);
+    putFixed(blockTicks, 4);
+    return true;
+}
+
+bool TraceWriter::isOpen() const {
+    return file != nullptr;
+}
+
+void TraceWriter::recordRelease(size_t threadIndex) {
+    tickReleases.push_back(threadIndex);
+}
+
+// Encode one tick, starting a new block with a snapshot of pending counts when due
+void TraceWriter::endTick(int runningThread, bool executed, bool completed, bool preempted) {
+    if (tickCount % blockTicks == 0) {
+        blockOffsets.push_back(fileOffset + buffer.size());
+        for (long long pending : pendingCounts) {
+            putVarint(static_cast<uint64_t>(pending));
+        }
+        previousRunning = -1;
+    }
+
+    if (!std::is_sorted(tickReleases.begin(), tickReleases.end())) {
+        std::sort(tickReleases.begin(), tickReleases.end());
+    }
+
+    uint64_t flags = (executed ? EXECUTED : 0) | (completed ? COMPLETED : 0) | (preempted ? PREEMPTED : 0);
+    putVarint(zigzagEncode(static_cast<long long>(runningThread) - previousRunning) << 3 | flags);
+    putVarint(tickReleases.size());
+
+    size_t previousRelease = 0;
+    for (size_t threadIndex : tickReleases) {
+        putVarint(threadIndex - previousRelease);
+        previousRelease = threadIndex;
+        pendingCounts[threadIndex]++;
+    }
+    if (completed && runningThread >= 0) {
+        pendingCounts[static_cast<size_t>(runningThread)]--;
+    }
+
+    tickReleases.clear();
+    previousRunning = runningThread;
+    tickCount++;
+
+    if (buffer.size() >= writeChunk) {
+        flushBuffer();
+    }
+}
+
+// Write the block index and footer, then close the file
+bool TraceWriter::close() {
+    if (file == nullptr) {
+        return false;
+    }
+
+    uint64_t indexOffset = fileOffset + buffer.size();
+    for (uint64_t offset : blockOffsets) {
+        putFixed(offset, 8);
+    }
+    putFixed(indexOffset, 8);
+    putFixed(blockOffsets.size(), 8);
+    putFixed(static_cast<uint64_t>(tickCount), 8);
+    buffer.insert(buffer.end(), footerMagic, footerMagic + 8);
+    flushBuffer();
+
+    if (fclose(file) != 0) {
+        failed = true;
+    }
+    file = nullptr;
+    if (failed) {
+        printf("Writing the trace file failed\n");
+    }
+    return !failed;
+}
+
+void TraceWriter::putByte(uint8_t value) {
+    buffer.push_back(value);
+}
+
+// Seven bits per byte, high bit set on every byte but the last
+void TraceWriter::putVarint(uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void TraceWriter::putFixed(uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        putByte(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void TraceWriter::flushBuffer() {
+    if (!buffer.empty() && fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+        failed = true;
+    }
+    fileOffset += buffer.size();
+    buffer.clear();
+}
+
+// Constructor and Destructor
+TraceReader::TraceReader()
+    : data(nullptr), dataSize(0), cursor(nullptr), blockEnd(nullptr), indexStart(nullptr), blockCount(0),
+      totalTicks(0), nextTime(0), threads(0), ticksPerBlock(1), kind(TraceScheduler::RATE_MONOTONIC),
+      previousRunning(-1), pendingCompletion(-1) {}
+
+TraceReader::~TraceReader() {
+    unmap();
+}
+
+void TraceReader::unmap() {
+#ifndef _WIN32
+    if (data != nullptr) {
+        munmap(const_cast<uint8_t*>(data), dataSize);
+    }
+#endif
+    data = nullptr;
+    dataSize = 0;
+}
+
+// Map the file and check the header, footer and index agree with each other
+bool TraceReader::open(const std::string& path) {
+    unmap();
+#ifdef _WIN32
+    printf("Trace replay needs mmap, which this build does not support\n");
+    (void)path;
+    return false;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        printf("Could not open trace file %s\n", path.c_str());
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < headerSize + footerSize) {
+        printf("%s is too small to be a trace\n", path.c_str());
+        ::close(fd);
+        return false;
+    }
+    dataSize = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, dataSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        printf("Could not map trace file %s\n", path.c_str());
+        dataSize = 0;
+        return false;
+    }
+    data = static_cast<const uint8_t*>(mapping);
+
+    const uint8_t* footer = data + dataSize - footerSize;
+    uint64_t indexOffset = readFixed(footer, 8);
+    blockCount = readFixed(footer + 8, 8);
+    totalTicks = static_cast<long long>(readFixed(footer + 16, 8));
+    uint64_t version = readFixed(data + 8, 4);
+    uint64_t scheduler = readFixed(data + 12, 4);
+    threads = static_cast<size_t>(readFixed(data + 16, 4));
+    ticksPerBlock = static_cast<uint32_t>(readFixed(data + 20, 4));
+    kind = static_cast<TraceScheduler>(scheduler);
+
+    bool valid = memcmp(data, headerMagic, 8) == 0 && memcmp(footer + 24, footerMagic, 8) == 0 &&
+                 version == traceVersion && scheduler <= static_cast<uint64_t>(TraceScheduler::ROUND_ROBIN) &&
+                 ticksPerBlock > 0 && indexOffset >= headerSize &&
+                 indexOffset + blockCount * 8 == dataSize - footerSize &&
+                 blockCount == (static_cast<uint64_t>(totalTicks) + ticksPerBlock - 1) / ticksPerBlock;
+    if (!valid) {
+        printf("%s is not a trace file this version can read\n", path.c_str());
+        unmap();
+        return false;
+    }
+
+    indexStart = data + indexOffset;
+    pendingCounts.assign(threads, 0);
+    return seek(0);
+#endif
+}
+
+long long TraceReader::tickCount() const {
+    return totalTicks;
+}
+
+size_t TraceReader::threadCount() const {
+    return threads;
+}
+
+TraceScheduler TraceReader::scheduler() const {
+    return kind;
+}
+
+const std::vector<long long>& TraceReader::pending() const {
+    return pendingCounts;
+}
+
+// Jump to the block holding the tick, then decode forward to it
+bool TraceReader::seek(long long time) {
+    if (data == nullptr || time < 0 || time > totalTicks) {
+        return false;
+    }
+
+    nextTime = (time / ticksPerBlock) * ticksPerBlock;
+    pendingCompletion = -1;
+    TraceTick skipped;
+    while (nextTime < time) {
+        if (!next(skipped)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TraceReader::next(TraceTick& tick) {
+    if (data == nullptr || nextTime >= totalTicks) {
+        return false;
+    }
+
+    // The previous tick's completion leaves the queue after that tick was displayed
+    if (pendingCompletion >= 0) {
+        pendingCounts[static_cast<size_t>(pendingCompletion)]--;
+        pendingCompletion = -1;
+    }
+
+    // Block start, load the snapshot of pending counts
+    if (nextTime % ticksPerBlock == 0) {
+        uint64_t block = static_cast<uint64_t>(nextTime / ticksPerBlock);
+        cursor = data + readFixed(indexStart + block * 8, 8);
+        blockEnd = block + 1 < blockCount ? data + readFixed(indexStart + (block + 1) * 8, 8) : indexStart;
+        if (cursor < data + headerSize || cursor > blockEnd || blockEnd > indexStart) {
+            return false;
+        }
+        for (size_t i = 0; i < threads; ++i) {
+            uint64_t pending;
+            if (!readVarint(pending)) {
+                return false;
+            }
+            pendingCounts[i] = static_cast<long long>(pending);
+        }
+        previousRunning = -1;
+    }
+
+    // Arrival replays can release several tasks on one thread in a tick, so the count is only bounded by
+    // the block's remaining bytes, at least one per release
+    uint64_t header;
+    uint64_t releaseCount;
+    if (!readVarint(header) || !readVarint(releaseCount) || releaseCount > static_cast<uint64_t>(blockEnd - cursor)) {
+        return false;
+    }
+
+    tick.time = nextTime;
+    tick.runningThread = static_cast<int>(previousRunning + zigzagDecode(header >> 3));
+    tick.executed = (header & EXECUTED) != 0;
+    tick.completed = (header & COMPLETED) != 0;
+    tick.preempted = (header & PREEMPTED) != 0;
+    if (tick.runningThread < -1 || tick.runningThread >= static_cast<int>(threads)) {
+        return false;
+    }
+
+    tick.releases.clear();
+    size_t threadIndex = 0;
+    for (uint64_t i = 0; i < releaseCount; ++i) {
+        uint64_t delta;
+        if (!readVarint(delta)) {
+            return false;
+        }
+        threadIndex += static_cast<size_t>(delta);
+        if (threadIndex >= threads) {
+            return false;
+        }
+        tick.releases.push_back(threadIndex);
+        pendingCounts[threadIndex]++;
+    }
+
+    if (tick.completed && tick.runningThread >= 0) {
+        pendingCompletion = tick.runningThread;
+    }
+    previousRunning = tick.runningThread;
+    nextTime++;
+    return true;
+}
+
+bool TraceReader::readVarint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (cursor >= blockEnd) {
+            return false;
+        }
+        uint8_t byte = *cursor++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file ScheduleTrace.h
+ * @brief Contains the schedule trace writer and reader class definitions
+ *
+ * Compact binary record of a scheduler run, one varint encoded record per tick.
+ * Ticks are grouped in blocks that start with a snapshot of every thread's
+ * pending task count, and an index of block offsets at the end of the file
+ * lets the reader jump to any tick without decoding what comes before it.
+ *
+ * Layout: header, blocks, block offset index, footer.
+ * Tick record: varint(zigzag(running - previous running) << 3 | flags),
+ * varint(release count), then the released thread indices as ascending deltas,
+ * a thread repeated once per task when it released several that tick.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdio.h>  // For FILE
+#include <string>
+#include <vector>
+
+enum class TraceScheduler : uint32_t { RATE_MONOTONIC = 0, ROUND_ROBIN = 1 };
+
+// One decoded tick of a trace
+struct TraceTick {
+    long long time;                // Tick number, starting at 0
+    int runningThread;             // Thread selected this tick, -1 if none
+    bool executed;                 // A task was serviced this tick
+    bool completed;                // The serviced task finished this tick
+    bool preempted;                // The thread that ran last tick still had work but lost the CPU
+    std::vector<size_t> releases;  // Threads that released a task this tick, ascending, once per task
+};
+
+class TraceWriter {
+private:
+    FILE* file;
+    std::vector<uint8_t> buffer;       // Bytes not yet written to the file
+    std::vector<uint64_t> blockOffsets;
+    std::vector<long long> pendingCounts;  // Tasks waiting in each thread, kept for the block snapshots
+    std::vector<size_t> tickReleases;      // Releases recorded for the current tick
+    uint64_t fileOffset;               // Offset of the first byte in the buffer
+    long long tickCount;
+    int previousRunning;
+    bool failed;
+
+    void putByte(uint8_t value);
+    void putVarint(uint64_t value);
+    void putFixed(uint64_t value, int bytes);
+    void flushBuffer();
+public:
+    static const uint32_t blockTicks = 4096;
+
+    // Constructor and Destructor
+    TraceWriter();
+    ~TraceWriter();  // Closes the trace if it is still open
+
+    bool open(const std::string& path, TraceScheduler scheduler, size_t threadCount);
+    bool isOpen() const;
+
+    void recordRelease(size_t threadIndex);  // Call once per released task in ascending thread order, before endTick
+    void endTick(int runningThread, bool executed, bool completed, bool preempted);
+
+    bool close();  // Writes the index and footer, returns false if any write failed
+};
+
+class TraceReader {
+private:
+    const uint8_t* data;    // Whole file, memory mapped
+    size_t dataSize;
+    const uint8_t* cursor;  // Next record to decode
+    const uint8_t* blockEnd;
+    const uint8_t* indexStart;
+    uint64_t blockCount;
+    long long totalTicks;
+    long long nextTime;
+    size_t threads;
+    uint32_t ticksPerBlock;
+    TraceScheduler kind;
+    int previousRunning;
+    int pendingCompletion;  // Thread whose task finished on the last decoded tick, -1 if none
+    std::vector<long long> pendingCounts;
+
+    bool readVarint(uint64_t& value);
+    void unmap();
+public:
+    // Constructor and Destructor
+    TraceReader();
+    ~TraceReader();
+
+    bool open(const std::string& path);  // Prints the problem and returns false if the file isn't a trace
+
+    long long tickCount() const;
+    size_t threadCount() const;
+    TraceScheduler scheduler() const;
+
+    bool seek(long long time);     // Next call to next() returns this tick
+    bool next(TraceTick& tick);    // Decode one tick, false at the end or on a corrupt record
+
+    // Tasks waiting in each thread as of the last decoded tick, after its releases and before its completion
+    const std::vector<long long>& pending() const;
+};
@@ -1,9 +1,9 @@
 /**
  * @file SchedulerCommon.h
- * @brief Contains the Thread definition
+ * @brief Contains the Thread and ThreadTable definitions and the TaskQueue type
  *
- * Contains the definition of the Thread struct
- * The struct is used by both algorithms
+ * Contains the definition of the Thread struct and the ThreadTable it is stored in
+ * Both are used by both algorithms, TaskQueue picks the queue tasks are stored in
  *
  * @date 11/5/24
  * @author Fiya Clerget, Marcello Novak
@@ -11,11 +11,142 @@
 #pragma once
 
 #include "Queue.h"
+#include "RingQueue.h"
+#include "Task.h"
+#include <cstddef>
+#include <vector>
 
+// Thread queues are ring buffers, define SCHEDULER_LINKED_QUEUE to use the linked Queue
+#ifdef SCHEDULER_LINKED_QUEUE
+typedef Queue TaskQueue;
+#else
+typedef RingQueue<Task> TaskQueue;
+#endif
+
+// Description of one periodic thread, as written in the examples and thread set files
 struct Thread {
-    Queue taskQueue;
     int priority;   // Fixed priority for the thread
     int size;       // Length of the task created
     int frequency;  // Fixed period of task execution for this thread
  
 };
+
+// Thread set stored as a structure of arrays
+// The scalar fields scanned every tick are contiguous, the task queues are kept apart
+struct ThreadTable {
+    std::vector<int> priorities;
+    std::vector<int> sizes;
+    std::vector<int> frequencies;
+    std::vector<TaskQueue> taskQueues;
+
+    size_t count() const { return priorities.size(); }
+
+    void assign(const std::vector<Thread>& threadSet) {
+        priorities.clear();
+        sizes.clear();
+        frequencies.clear();
+        for (const Thread& thread : threadSet) {
+            priorities.push_back(thread.priority);
+            sizes.push_back(thread.size);
+            frequencies.push_back(thread.frequency);
+        }
+        taskQueues.assign(threadSet.size(), TaskQueue());
+    }
+};
+
+// Built in thread sets, shared by the single CPU schedulers
+enum class ExampleType { STRUCTURED, STARVED };
+
+// Selection policy for schedulers that take either, like the multicore simulation and the runtime
+enum class CorePolicy { RATE_MONOTONIC, ROUND_ROBIN };
+
+// Totals reported at the end of a simulation run
+struct SimulationStats {
+    long long tasksCreated;   // Tasks released over the horizon
+    long long tasksServiced;  // Tasks that ran to completion
+    long long deadlineMisses; // Tasks finished after their thread's next release or still queued past it at the horizon, RM and EDF only
+    long long tasksDue;       // Tasks whose deadline fell within the horizon, what the misses are a share of
+    long long extrapolatedTicks;  // Ticks covered by repeating a steady hyperperiod instead of simulating
+    long long contextSwitches;    // Times a task ran on a different thread than the last task that ran
+    long long preemptions;        // Switches that left the last thread's task unfinished
+    long long overheadTicks;      // Ticks spent switching between threads instead of running a task
+};
+
+// Ticks the CPU loses to a context switch before the incoming thread's task runs, both 0 makes switches free
+struct SwitchCosts {
+    int switchTicks = 0;  // Saving the outgoing thread's state and dispatching the incoming one
+    int refillTicks = 0;  // Added when the switch preempts a task, which has to refill the cache once it resumes
+
+    bool any() const { return switchTicks > 0 || refillTicks > 0; }
+};
+
+// Thread that last ran a task and whether it finished it, for counting context switches and preemptions
+// Also holds the switch under way while its overhead is paid, the thread keeps the CPU until it is paid
+struct SwitchTracker {
+    int lastThread = -1;  // -1 until a task has run
+    bool lastFinished = true;
+    int pendingThread = -1;  // Thread being switched to, -1 if no switch is under way
+    int overheadLeft = 0;    // Ticks of the pending switch not yet paid
+
+    // A stretch of thread running a task, finished if the task completed at its end
+    void record(int thread, bool finished, long long& switches, long long& preemptions) {
+        if (thread != lastThread && lastThread != -1) {
+            switches++;
+            if (!lastFinished) {
+                preemptions++;
+            }
+        }
+        lastThread = thread;
+        lastFinished = finished;
+        pendingThread = -1;
+    }
+
+    // Overhead ticks left before thread can run, starting a switch to it unless one is under way
+    // Picking another thread midway abandons the switch, the ticks paid for it are lost
+    int overheadBefore(int thread, const SwitchCosts& costs) {
+        if (thread == lastThread || lastThread == -1) {
+            return 0;
+        }
+        if (thread != pendingThread) {
+            pendingThread = thread;
+            overheadLeft = costs.switchTicks + (lastFinished ? 0 : costs.refillTicks);
+        }
+        return overheadLeft;
+    }
+};
+
+// Tasks of periodic threads due within the horizon, thread i first releasing at firstReleases[i]
+// Each task is due when its thread next releases, one frequency after its own release
+inline long long tasksDueWithin(const std::vector<int>& frequencies, const std::vector<long long>& firstReleases,
+                                long long horizon) {
+    long long due = 0;
+    for (size_t i = 0; i < frequencies.size(); ++i) {
+        long long firstDeadline = firstReleases[i] + frequencies[i];
+        if (firstDeadline <= horizon) {
+            due += (horizon - firstDeadline) / frequencies[i] + 1;
+        }
+    }
+    return due;
+}
+
+// Visit each element of a queue front to back, rotating it through once so its order is kept
+template <typename Queue, typename Visit>
+void forEachQueued(Queue& queue, Visit visit) {
+    for (size_t queued = queue.size(); queued > 0; --queued) {
+        auto front = *queue.top();
+        queue.pop();
+        visit(front);
+        queue.push(front);  // Popped first, so the push never has to grow the ring
+    }
+}
+
+// Tasks still queued at the horizon that aren't due yet, the rest of the backlog is overdue and can only finish late
+// An extrapolated run's backlog outgrows its queues, but the tasks it leaves out are the oldest, never ones not yet due
+// Queues hold a mix of deadlines when threads share them, so every deadline is looked at
+inline long long queuedNotYetDue(std::vector<RingQueue<long long>>& taskDeadlines, long long horizon) {
+    long long notDue = 0;
+    for (RingQueue<long long>& deadlines : taskDeadlines) {
+        forEachQueued(deadlines, [&](long long deadline) { notDue += (deadline > horizon); });
+    }
+    return notDue;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file SpscRing.h
+ * @brief Contains the single producer, single consumer ring class template
+ *
+ * Bounded lock-free FIFO for handing elements from one thread to another.
+ * The producer only writes the tail and the consumer only writes the head,
+ * each on its own cache line, so neither side ever waits on a lock. Pushes
+ * are all or nothing, and a producer that finds the ring full decides for
+ * itself whether to wait, try again later or drop what it had.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+template <typename T>
+class SpscRing {
+private:
+    std::vector<T> slots;   // Always a power of two
+    std::size_t mask;
+    alignas(64) std::atomic<std::size_t> head;  // Count of elements popped, only written by the consumer
+    alignas(64) std::atomic<std::size_t> tail;  // Count of elements pushed, only written by the producer
+
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscRing(std::size_t minimumCapacity) : mask(0), head(0), tail(0) {
+        std::size_t capacity = 1;
+        while (capacity < minimumCapacity) {
+            capacity *= 2;
+        }
+        slots.resize(capacity);
+        mask = capacity - 1;
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Producer only, pushes all count elements, or none of them if they don't fit
+    bool tryPush(const T* elements, std::size_t count) {
+        std::size_t pushed = tail.load(std::memory_order_relaxed);
+        std::size_t popped = head.load(std::memory_order_acquire);
+        if (slots.size() - (pushed - popped) < count) {
+            return false;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            slots[(pushed + i) & mask] = elements[i];
+        }
+        tail.store(pushed + count, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only, pops up to limit elements into out and returns how many it popped
+    std::size_t pop(T* out, std::size_t limit) {
+        std::size_t popped = head.load(std::memory_order_relaxed);
+        std::size_t available = tail.load(std::memory_order_acquire) - popped;
+        std::size_t count = available < limit ? available : limit;
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = slots[(popped + i) & mask];
+        }
+        head.store(popped + count, std::memory_order_release);
+        return count;
+    }
+
+    std::size_t capacity() const { return slots.size(); }
+};
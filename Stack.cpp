@@ -11,21 +11,43 @@
 
 #include "Stack.h"
 #include <stdio.h>  // For printf
-#include <stdlib.h> // For rand
-#include <ctime>    // For time(NULL)
+#include <type_traits>
+
+static_assert(std::is_trivially_destructible<StackNode>::value, "Stack nodes are freed in bulk with the pool");
 
 // Constructor and Destructor
-Stack::Stack() : head(nullptr), tail(nullptr) {}  // Both head and tail are null
+Stack::Stack() : head(nullptr), tail(nullptr), arrivals(nullptr) {}  // Both head and tail are null
 
+// Nodes hold plain task data, so the pool frees them all with its slabs
 Stack::~Stack() {
-    while (!isEmpty()) {
-        pop();
+    head = nullptr;
+    tail = nullptr;
+}
+
+// Copy every task bottom to top, so the copy pops them in the same order
+Stack::Stack(const Stack& other) : head(nullptr), tail(nullptr), arrivals(other.arrivals) {
+    for (StackNode* current = other.tail; current != nullptr; current = current->prevTask) {
+        push(current->taskData);
+    }
+}
+
+// Empty the stack into its own pool, then copy the other one's tasks in
+Stack& Stack::operator=(const Stack& other) {
+    if (this != &other) {
+        while (!isEmpty()) {
+            pop();
+        }
+        for (StackNode* current = other.tail; current != nullptr; current = current->prevTask) {
+            push(current->taskData);
+        }
+        arrivals = other.arrivals;
     }
+    return *this;
 }
 
 // Push and Pop methods from top of stack
 void Stack::push(Task task) {
-    StackNode* newNode = new StackNode{task, head, nullptr};  // Create new node with task data
+    StackNode* newNode = nodePool.allocate(task, head, nullptr);  // Create new node with task data
 
     // If stack isn't empty, update previous head's prevTask
     if (head != nullptr) {
@@ -51,7 +73,7 @@ void Stack::pop() {
             tail = nullptr;  // If the stack is now empty, set tail to null
         }
 
-        delete temp; // Delete the old head
+        nodePool.release(temp); // Return the old head to the pool
 
     } else {
         printf("Stack is empty, cannot pop\n");
@@ -86,24 +108,40 @@ void Stack::printStack() {
 
 // Stack scheduler example function
 void Stack::runExample() {
-    srand(static_cast<unsigned int>(time(NULL)));  // Seed the random number generator
+    run(10001, OutputLevel::TIMELINE);  // Example runs for 10001 "time units"
+}
+
+// Later runs take their tasks from source, nullptr goes back to the default workload
+void Stack::setArrivals(ArrivalSource* source) {
+    arrivals = source;
+}
+
+// Stack scheduler loop, only prints the stack each "time unit" at timeline output
+void Stack::run(long long horizon, OutputLevel output) {
+    // Without a source, 20% chance of a task between 1 and 6 "time units" each "time unit"
+    WorkloadOptions defaultWorkload;
+    defaultWorkload.seed = randomSeed();
+    WorkloadGenerator generator(defaultWorkload);
+    ArrivalSource* source = (arrivals != nullptr) ? arrivals : &generator;
 
     // Counters for tasks created and serviced
-    int taskCounter = 0;
-    int servicedCounter = 0;
+    long long taskCounter = 0;
+    long long servicedCounter = 0;
 
-    int timeCounter = 0;  
-    while (timeCounter <= 10000) {  // Example runs for 1000 "time units"
+    long long timeCounter = 0;  
+    while (timeCounter < horizon) {
 
-        // 20% chance of adding a new task each "time unit"
-        if (rand() % 5 == 0) {
-            Task newTask(rand() % 6 + 1);  // req between 1 and 5 "time units"
-            push(newTask);
+        // Add every arrival due this "time unit", the thread is ignored
+        Arrival arrival;
+        while (source->next(timeCounter, arrival)) {
+            push(Task(arrival.size, timeCounter));
             taskCounter++;  // Increment task counter
-        };
+        }
 
         // Print the current stack
-        printStack();
+        if (output == OutputLevel::TIMELINE) {
+            printStack();
+        }
         
         // Iterate top task's serviced counter
         if (!isEmpty()) {
@@ -123,6 +161,8 @@ void Stack::runExample() {
     }
 
     // Print tasks completed and tasks left in stack
-    printf("Tasks completed: %d\n", servicedCounter);
-    printf("Tasks left in stack: %d\n", taskCounter);
+    if (output != OutputLevel::NONE) {
+        printf("Tasks completed: %lld\n", servicedCounter);
+        printf("Tasks left in stack: %lld\n", taskCounter);
+    }
 }
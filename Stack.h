@@ -13,6 +13,10 @@
 
 #pragma once
 #include "Task.h"
+#include "ArrivalTrace.h"
+#include "Workload.h"
+#include "NodePool.h"
+#include "OutputLevel.h"
 
 struct StackNode {
     Task taskData;
@@ -24,11 +28,17 @@ class Stack {
 private:
     StackNode* head;  // Top of the stack
     StackNode* tail;  // Bottom of the stack (new)
+    NodePool<StackNode> nodePool;  // Slab storage for the nodes
+    ArrivalSource* arrivals;  // Where tasks come from, a randomly seeded default workload when not set
 public:
 
     // Constructor and Destructor
     Stack();
     ~Stack();
+
+    // Copies get their own nodes, in a pool of their own
+    Stack(const Stack& other);
+    Stack& operator=(const Stack& other);
     
     // Push and Pop methods
     void push(Task task);
@@ -39,5 +49,7 @@ public:
 
     void printStack();  // Function to print the stack
     void runExample();  // Function to run the example
+    void run(long long horizon, OutputLevel output);  // Run for any horizon at the given output level
+    void setArrivals(ArrivalSource* source);  // Take arrivals from source in later runs, nullptr goes back to the default workload
 
 };
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @file StaticScheduler.h
+ * @brief Contains the rate monotonic and round robin schedulers for compile time task sets
+ *
+ * Fixed configurations, in the style of an embedded system. The task set is
+ * a template parameter, so the hyperperiod and the release calendar are
+ * built by the compiler, and tick by tick runs look up which threads release
+ * in that static table instead of checking every thread's next release time.
+ * Selection, service and the display are the regular schedulers', so every
+ * run matches the runtime configured scheduler on the same set.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "RateMonotonic.h"
+#include "RoundRobin.h"
+#include "StaticTaskSet.h"
+#include "TickEngine.h"
+#include "AsyncTimelineRenderer.h"
+#include <vector>
+
+// Rate monotonic on a constexpr task set, for example StaticRateMonotonicScheduler<rateMonotonicStructured>
+template <const auto& TaskSet>
+class StaticRateMonotonicScheduler : public RateMonotonicScheduler {
+    private:
+        static constexpr long long hyperperiod = hyperperiodOf(TaskSet);
+        static constexpr ReleaseCalendar<hyperperiod> calendar = makeReleaseCalendar<hyperperiod>(TaskSet);
+
+        // Threads first release at their frequency, so nothing releases at time zero
+        int releaseTick(size_t threadIndex, long long time) {
+            if (time == 0 || (calendar.at(time) >> threadIndex & 1) == 0) {
+                return 0;
+            }
+            nextReleaseTimes[threadIndex] = time + TaskSet[threadIndex].frequency;
+            addTask(TaskSet[threadIndex].priority, time, nextReleaseTimes[threadIndex]);
+            return 1;
+        }
+
+        template <typename Policy, typename Renderer>
+        friend TickTotals runTickEngine(Policy& policy, Renderer& renderer, size_t threadCount, long long horizon,
+                                        TraceWriter* trace, const SwitchCosts& costs);
+    public:
+        StaticRateMonotonicScheduler() : RateMonotonicScheduler(std::vector<Thread>(TaskSet.begin(), TaskSet.end())) {}
+
+        // Tick by tick run off the release calendar, run() and simulate() are the runtime configured ones
+        TickTotals runTicks(long long horizon, OutputLevel output) {
+            tickLatencies.assign(threads.count(), ThreadLatency(horizon));
+
+            TickTotals totals;
+            if (output == OutputLevel::TIMELINE) {
+                AsyncTimelineRenderer renderer;
+                totals = runTickEngine(*this, renderer, TaskSet.size(), horizon, trace, switchCosts);
+            } else {
+                NullRenderer renderer;
+                totals = runTickEngine(*this, renderer, TaskSet.size(), horizon, trace, switchCosts);
+            }
+            recordUnfinished(horizon);
+            reportTicks(totals, horizon, output);
+            return totals;
+        }
+};
+
+// Round robin on a constexpr task set, for example StaticRoundRobinScheduler<roundRobinStarved>
+template <const auto& TaskSet>
+class StaticRoundRobinScheduler : public RoundRobinScheduler {
+    private:
+        static constexpr long long hyperperiod = hyperperiodOf(TaskSet);
+        static constexpr ReleaseCalendar<hyperperiod> calendar = makeReleaseCalendar<hyperperiod>(TaskSet);
+
+        int releaseTick(size_t threadIndex, long long time) {
+            if ((calendar.at(time) >> threadIndex & 1) == 0) {
+                return 0;
+            }
+            addTask(threadIndex, time);
+            return 1;
+        }
+
+        template <typename Policy, typename Renderer>
+        friend TickTotals runTickEngine(Policy& policy, Renderer& renderer, size_t threadCount, long long horizon,
+                                        TraceWriter* trace, const SwitchCosts& costs);
+    public:
+        StaticRoundRobinScheduler() : RoundRobinScheduler(std::vector<Thread>(TaskSet.begin(), TaskSet.end())) {}
+
+        // Tick by tick run off the release calendar, run() and simulate() are the runtime configured ones
+        TickTotals runTicks(long long horizon, OutputLevel output) {
+            tickQuantum = 0;
+            demandEstimates.assign(threads.count(), 0);
+            tickLatencies.assign(threads.count(), ThreadLatency(horizon));
+
+            TickTotals totals;
+            if (output == OutputLevel::TIMELINE) {
+                AsyncTimelineRenderer renderer;
+                totals = runTickEngine(*this, renderer, TaskSet.size(), horizon, trace, switchCosts);
+            } else {
+                NullRenderer renderer;
+                totals = runTickEngine(*this, renderer, TaskSet.size(), horizon, trace, switchCosts);
+            }
+            recordUnfinished(horizon);
+            reportTicks(totals, horizon, output);
+            return totals;
+        }
+};
@@ -0,0 +1,84 @@
+/**
+ * @file StaticTaskSet.h
+ * @brief Contains the built in task sets as constexpr tables and their release calendars
+ *
+ * The STRUCTURED and STARVED examples are fixed at build time, so they are
+ * declared here as constexpr arrays. makeReleaseCalendar turns a table into
+ * the releases of one hyperperiod while compiling: entry t is a bitmask of
+ * the threads whose frequency divides t, and the pattern repeats every
+ * hyperperiod after that.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "SchedulerCommon.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>  // For lcm
+
+// Rate monotonic examples, {priority, size, frequency}
+constexpr std::array<Thread, 4> rateMonotonicStructured = {{
+    {1, 1, 3},   // Thread 1: priority 1, size 1, frequency 3
+    {2, 2, 6},   // Thread 2: priority 2, size 2, frequency 6
+    {3, 2, 12},  // Thread 3: priority 3, size 2, frequency 12
+    {4, 4, 24}   // Thread 4: priority 4, size 4, frequency 24
+}};
+
+constexpr std::array<Thread, 4> rateMonotonicStarved = {{
+    {1, 1, 3},   // Thread 1: priority 1, size 1, frequency 3
+    {2, 2, 6},   // Thread 2: priority 2, size 2, frequency 6
+    {3, 4, 12},  // Thread 3: priority 3, size 4, frequency 12
+    {4, 4, 24}   // Thread 4: priority 4, size 4, frequency 24
+}};
+
+// Round robin examples, the priority is only a label
+constexpr std::array<Thread, 4> roundRobinStructured = {{
+    {1, 2, 24},  // Thread 1: size 2, freq 24
+    {2, 4, 24},  // Thread 2: size 4, freq 24
+    {3, 6, 24},  // Thread 3: size 6, freq 24
+    {4, 8, 24}   // Thread 4: size 8, freq 24
+}};
+
+constexpr std::array<Thread, 4> roundRobinStarved = {{
+    {1, 1, 8},  // Thread 1: size 1, freq 8
+    {2, 3, 8},  // Thread 2: size 3, freq 8
+    {3, 2, 8},  // Thread 3: size 2, freq 8
+    {4, 8, 8}   // Thread 4: size 8, freq 8
+}};
+
+// LCM of the frequencies
+template <size_t N>
+constexpr long long hyperperiodOf(const std::array<Thread, N>& taskSet) {
+    long long hyperperiod = 1;
+    for (size_t i = 0; i < N; ++i) {
+        hyperperiod = std::lcm(hyperperiod, static_cast<long long>(taskSet[i].frequency));
+    }
+    return hyperperiod;
+}
+
+// Threads releasing at each offset into the hyperperiod, one bit per thread
+template <long long Hyperperiod>
+struct ReleaseCalendar {
+    std::array<uint64_t, Hyperperiod> releases;
+
+    constexpr uint64_t at(long long time) const { return releases[static_cast<size_t>(time % Hyperperiod)]; }
+};
+
+template <long long Hyperperiod, size_t N>
+constexpr ReleaseCalendar<Hyperperiod> makeReleaseCalendar(const std::array<Thread, N>& taskSet) {
+    static_assert(N <= 64, "A release calendar holds at most 64 threads");
+    ReleaseCalendar<Hyperperiod> calendar{};
+    for (long long offset = 0; offset < Hyperperiod; ++offset) {
+        uint64_t releasing = 0;
+        for (size_t i = 0; i < N; ++i) {
+            if (offset % taskSet[i].frequency == 0) {
+                releasing |= uint64_t(1) << i;
+            }
+        }
+        calendar.releases[static_cast<size_t>(offset)] = releasing;
+    }
+    return calendar;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file SteadyState.cpp
+ * @brief Steady state detector implementation.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "SteadyState.h"
+#include <algorithm>  // For min, max
+#include <numeric>    // For gcd
+
+SteadyStateDetector::SteadyStateDetector()
+    : hyperperiod(0), nextBoundaryTime(-1), repeatLength(0), historyLimit(0), growth{0, 0, 0, 0, 0, 0, 0, 0}, deadlineShift(0) {}
+
+void SteadyStateDetector::start(const ThreadTable& threads, long long horizon, long long firstBoundary) {
+    stop();
+
+    // Only worth it if several hyperperiods fit, which also keeps the LCM from overflowing
+    long long limit = horizon / 4;
+    long long lcm = 1;
+    for (size_t i = 0; i < threads.count() && lcm <= limit; ++i) {
+        long long frequency = threads.frequencies[i];
+        lcm = lcm / std::gcd(lcm, frequency) * frequency;
+    }
+    if (threads.count() == 0 || lcm > limit) {
+        return;
+    }
+
+    hyperperiod = lcm;
+    nextBoundaryTime = firstBoundary * lcm;
+    exactLengths.assign(threads.count(), false);
+
+    // Look further back for small thread sets, comparing snapshots costs a pass over every thread
+    historyLimit = std::max<size_t>(2, std::min<size_t>(64, 4096 / threads.count()));
+}
+
+void SteadyStateDetector::requireExactLength(size_t threadIndex) {
+    if (threadIndex < exactLengths.size()) {
+        exactLengths[threadIndex] = true;
+    }
+}
+
+long long SteadyStateDetector::nextBoundary() const {
+    return nextBoundaryTime;
+}
+
+bool SteadyStateDetector::equivalent(const Snapshot& earlier, const Snapshot& current, const ThreadTable& threads,
+                                     long long periods) const {
+    if (earlier.cursor != current.cursor || earlier.quantumUsed != current.quantumUsed ||
+        earlier.switches.lastThread != current.switches.lastThread ||
+        earlier.switches.lastFinished != current.switches.lastFinished ||
+        earlier.switches.pendingThread != current.switches.pendingThread ||
+        earlier.switches.overheadLeft != current.switches.overheadLeft) {
+        return false;
+    }
+
+    // A backlog falling behind only repeats if everything served in the stretch was already late, and stays late
+    long long shift = periods * hyperperiod;
+    if (!commonShift(earlier, current, shift)) {
+        return false;
+    }
+    if (shift != periods * hyperperiod &&
+        current.stats.deadlineMisses - earlier.stats.deadlineMisses != current.stats.tasksServiced - earlier.stats.tasksServiced) {
+        return false;
+    }
+
+    for (size_t i = 0; i < current.queues.size(); ++i) {
+        const QueueState& before = earlier.queues[i];
+        const QueueState& now = current.queues[i];
+        if (before.frontServiced != now.frontServiced) {
+            return false;
+        }
+
+        // Equal, or long enough both times that the thread stays busy the whole stretch and not shrinking
+        long long drainLimit = periods * hyperperiod / threads.sizes[i] + 2;
+        bool stillBusy = !exactLengths[i] && before.length > drainLimit && now.length > before.length;
+        if (now.length != before.length && !stillBusy) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SteadyStateDetector::commonShift(const Snapshot& earlier, const Snapshot& current, long long& shift) const {
+    bool found = false;
+    for (size_t i = 0; i < current.frontDeadlines.size(); ++i) {
+        if (earlier.queues[i].length == 0 || current.queues[i].length == 0) {
+            continue;
+        }
+        long long moved = current.frontDeadlines[i] - earlier.frontDeadlines[i];
+        if (found && moved != shift) {
+            return false;
+        }
+        shift = moved;
+        found = true;
+    }
+    return true;
+}
+
+SteadyStateDetector::Snapshot SteadyStateDetector::capture(ThreadTable& threads, const SimulationStats& stats, size_t cursor,
+                                                           int quantumUsed, const SwitchTracker& switches) const {
+    Snapshot current;
+    current.queues.resize(threads.count());
+    current.cursor = cursor;
+    current.quantumUsed = quantumUsed;
+    current.switches = switches;
+    current.stats = stats;
+    for (size_t i = 0; i < threads.count(); ++i) {
+        TaskQueue& taskQueue = threads.taskQueues[i];
+        current.queues[i] = {static_cast<long long>(taskQueue.size()), taskQueue.isEmpty() ? 0 : taskQueue.top()->getServiced()};
+    }
+    return current;
+}
+
+bool SteadyStateDetector::atBoundary(ThreadTable& threads, const SimulationStats& stats, size_t cursor, int quantumUsed,
+                                     const SwitchTracker& switches) {
+    return record(capture(threads, stats, cursor, quantumUsed, switches), threads);
+}
+
+bool SteadyStateDetector::atBoundary(ThreadTable& threads, const SimulationStats& stats, const std::vector<long long>& frontDeadlines) {
+    Snapshot current = capture(threads, stats, 0, 0, SwitchTracker());
+    current.frontDeadlines = frontDeadlines;
+    return record(std::move(current), threads);
+}
+
+bool SteadyStateDetector::record(Snapshot current, const ThreadTable& threads) {
+    const SimulationStats& stats = current.stats;
+    nextBoundaryTime += hyperperiod;
+
+    // Newest first, so the shortest repeat wins
+    for (size_t back = 1; back <= history.size(); ++back) {
+        const Snapshot& earlier = history[history.size() - back];
+        if (equivalent(earlier, current, threads, static_cast<long long>(back))) {
+            repeatLength = static_cast<long long>(back) * hyperperiod;
+            growth.tasksCreated = stats.tasksCreated - earlier.stats.tasksCreated;
+            growth.tasksServiced = stats.tasksServiced - earlier.stats.tasksServiced;
+            growth.deadlineMisses = stats.deadlineMisses - earlier.stats.deadlineMisses;
+            growth.contextSwitches = stats.contextSwitches - earlier.stats.contextSwitches;
+            growth.preemptions = stats.preemptions - earlier.stats.preemptions;
+            growth.overheadTicks = stats.overheadTicks - earlier.stats.overheadTicks;
+            deadlineShift = repeatLength;
+            commonShift(earlier, current, deadlineShift);
+            return true;
+        }
+    }
+
+    if (history.size() == historyLimit) {
+        history.erase(history.begin());
+    }
+    history.push_back(std::move(current));
+    return false;
+}
+
+long long SteadyStateDetector::period() const {
+    return repeatLength;
+}
+
+const SimulationStats& SteadyStateDetector::growthPerPeriod() const {
+    return growth;
+}
+
+long long SteadyStateDetector::deadlineShiftPerPeriod() const {
+    return deadlineShift;
+}
+
+void SteadyStateDetector::stop() {
+    hyperperiod = 0;
+    nextBoundaryTime = -1;
+    repeatLength = 0;
+    history.clear();
+    exactLengths.clear();
+}
@@ -0,0 +1,89 @@
+/**
+ * @file SteadyState.h
+ * @brief Contains the steady state detector class definition
+ *
+ * Every thread releases strictly periodically, so the release pattern
+ * repeats every hyperperiod (the LCM of the frequencies). The detector
+ * snapshots the scheduler at each hyperperiod boundary and reports when one
+ * is equivalent to an earlier one, from then on every stretch of that many
+ * hyperperiods plays out the same and the counters can be advanced a whole
+ * number of them at once. Round robin's selection state can take several
+ * hyperperiods to come around, so a window of recent snapshots is kept.
+ *
+ * A queue is summarized by its length and its front task's serviced count,
+ * since the tasks behind the front are all untouched and the same size.
+ * Queues too long to drain within the repeat only need to keep growing,
+ * which lets a steadily growing backlog count as a repeat too.
+ *
+ * Deadline driven schedulers also pass each queue's front deadline. Those
+ * repeat when every front moved by the same amount, which is less than the
+ * repeat's length when an overloaded backlog keeps falling further behind.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "SchedulerCommon.h"
+#include <cstddef>
+#include <vector>
+
+class SteadyStateDetector {
+private:
+    struct QueueState {
+        long long length;
+        int frontServiced;
+    };
+
+    struct Snapshot {
+        std::vector<QueueState> queues;
+        std::vector<long long> frontDeadlines;  // Empty unless the scheduler tracks deadlines
+        size_t cursor;
+        int quantumUsed;
+        SwitchTracker switches;
+        SimulationStats stats;
+    };
+
+    long long hyperperiod;      // 0 when detection is off
+    long long nextBoundaryTime;
+    long long repeatLength;     // Ticks in the repeating stretch once found
+    std::vector<Snapshot> history;  // Recent boundaries, oldest first
+    std::vector<bool> exactLengths; // Queues that only repeat at the same length
+    size_t historyLimit;
+    SimulationStats growth;
+    long long deadlineShift;    // How far the front deadlines move in each repeating stretch
+
+    // True if the schedule from current plays out like the one from earlier over periods hyperperiods
+    bool equivalent(const Snapshot& earlier, const Snapshot& current, const ThreadTable& threads, long long periods) const;
+    // How far every front deadline moved, left at its value if no queue is busy at both, false if they moved apart
+    bool commonShift(const Snapshot& earlier, const Snapshot& current, long long& shift) const;
+    Snapshot capture(ThreadTable& threads, const SimulationStats& stats, size_t cursor, int quantumUsed,
+                     const SwitchTracker& switches) const;
+    bool record(Snapshot current, const ThreadTable& threads);
+public:
+    // Constructor
+    SteadyStateDetector();
+
+    // Turn detection on for runs up to horizon if a few hyperperiods fit in it
+    // firstBoundary is the first multiple of the hyperperiod that has the full release pattern
+    void start(const ThreadTable& threads, long long horizon, long long firstBoundary);
+
+    // Only count this thread's queue as repeating when its length matches exactly, call after start
+    void requireExactLength(size_t threadIndex);
+
+    long long nextBoundary() const;  // Time of the next snapshot, or -1 when detection is off
+
+    // Snapshot the scheduler at nextBoundary(), before that tick's releases
+    // cursor and quantumUsed are round robin's selection state, switches the last thread that ran and any switch under way
+    // Returns true once the state repeats
+    bool atBoundary(ThreadTable& threads, const SimulationStats& stats, size_t cursor = 0, int quantumUsed = 0,
+                    const SwitchTracker& switches = SwitchTracker());
+
+    // Same, for schedulers that pick by deadline, frontDeadlines has one entry per thread (ignored if its queue is empty)
+    bool atBoundary(ThreadTable& threads, const SimulationStats& stats, const std::vector<long long>& frontDeadlines);
+
+    long long period() const;  // Ticks in the repeating stretch, a multiple of the hyperperiod
+    const SimulationStats& growthPerPeriod() const;  // Tasks created, serviced and switches in each repeating stretch
+    long long deadlineShiftPerPeriod() const;        // Front deadline movement in each repeating stretch
+    void stop();
+};
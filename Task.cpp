@@ -11,8 +11,10 @@
 
 #include "Task.h"
 
-// Task constructor
-Task::Task(int req) : requested(req), serviced(0) {}
+// Task constructors
+Task::Task(int req) : Task(req, 0) {}
+
+Task::Task(int req, long long release) : requested(req), serviced(0), releaseTick(release), firstRunTick(-1), completionTick(-1) {}
 
 // Getter and setter methods for Task class
 int Task:: getRequested() {
@@ -17,10 +17,21 @@ class Task {
 private:
 	int requested;
 	int serviced;
+	long long releaseTick;     // Tick the task was released
+	long long firstRunTick;    // Tick it first ran, -1 until then
+	long long completionTick;  // Tick it finished by, -1 until then
 public:
 	Task(int req);
+	Task(int req, long long release);
 	int getRequested();
 	int getServiced();
 	void setServiced(int serv);
+
+	// Tick timestamps, inline since the tick loops touch them on every run
+	long long getReleaseTick() { return releaseTick; }
+	long long getFirstRunTick() { return firstRunTick; }
+	void setFirstRunTick(long long tick) { firstRunTick = tick; }
+	long long getCompletionTick() { return completionTick; }
+	void setCompletionTick(long long tick) { completionTick = tick; }
 };
 
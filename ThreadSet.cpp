@@ -0,0 +1,77 @@
+/**
+ * @file ThreadSet.cpp
+ * @brief Thread set loading implementation.
+ *
+ * Implementation of the thread set file reader and generator.
+ * Loaded sets are handed to the schedulers, which store them in a ThreadTable.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "ThreadSet.h"
+#include <fstream>
+#include <sstream>
+#include <stdio.h>  // For printf
+
+// Read one thread per line, checking every field is a positive number
+bool loadThreadSet(const std::string& path, std::vector<Thread>& threadSet) {
+    std::ifstream file(path);
+    if (!file) {
+        printf("Could not open thread set file %s\n", path.c_str());
+        return false;
+    }
+
+    threadSet.clear();
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+
+        // Skip blank lines and comments
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        Thread thread;
+        std::string extra;
+        if (!(fields >> thread.priority >> thread.size >> thread.frequency) || (fields >> extra)) {
+            printf("%s:%d: expected \"priority size frequency\"\n", path.c_str(), lineNumber);
+            return false;
+        }
+        if (thread.priority < 1 || thread.size < 1 || thread.frequency < 1) {
+            printf("%s:%d: priority, size and frequency must be at least 1\n", path.c_str(), lineNumber);
+            return false;
+        }
+        threadSet.push_back(thread);
+    }
+
+    if (threadSet.empty()) {
+        printf("Thread set file %s has no threads\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Threads cycle through four harmonic periods and sizes 1-3, keeping utilization under 50%
+std::vector<Thread> generateThreadSet(size_t threadCount) {
+    // Shortest period is the first power of two at least twice the thread count
+    int basePeriod = 1;
+    while (static_cast<size_t>(basePeriod) < 2 * threadCount) {
+        basePeriod *= 2;
+    }
+
+    std::vector<Thread> threadSet;
+    threadSet.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        size_t periodClass = i % 4;
+        Thread thread;
+        thread.priority = static_cast<int>(periodClass * threadCount + i / 4) + 1;  // Shorter periods first
+        thread.size = static_cast<int>(i % 3) + 1;
+        thread.frequency = basePeriod << periodClass;
+        threadSet.push_back(thread);
+    }
+    return threadSet;
+}
@@ -0,0 +1,22 @@
+/**
+ * @file ThreadSet.h
+ * @brief Contains the thread set loading functions
+ *
+ * Functions to read a thread set from a text file, or generate a large one.
+ * Thread set files hold one "priority size frequency" line per thread,
+ * blank lines and lines starting with # are skipped.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "SchedulerCommon.h"
+#include <string>
+#include <vector>
+
+// Read a thread set file, prints the problem and returns false if it is malformed
+bool loadThreadSet(const std::string& path, std::vector<Thread>& threadSet);
+
+// Build a harmonic periodic thread set of any size, priorities follow rate monotonic order
+std::vector<Thread> generateThreadSet(size_t threadCount);
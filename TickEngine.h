@@ -0,0 +1,152 @@
+/**
+ * @file TickEngine.h
+ * @brief Contains the tick engine shared by the single CPU schedulers
+ *
+ * Every tick by tick run goes through the same loop: release, select, draw,
+ * service, then trace. The scheduler is the policy, supplying the hooks
+ * below, and the renderer decides whether anything is drawn. Both are
+ * template parameters, so the hooks are inlined into one loop per scheduler
+ * and a run with the NullRenderer has no drawing code in it at all.
+ *
+ * With switch costs, a tick that selects a different thread than the one
+ * that last ran is spent on the switch instead of serviced, until the
+ * switch is paid. The selected thread is drawn as running meanwhile and the
+ * trace records it as not executing.
+ *
+ * Policy hooks:
+ *   int releaseTick(size_t thread, long long time)   Tasks the thread released this tick
+ *   size_t releaseQueue(size_t thread)               Queue the thread releases into, only asked when tracing
+ *   TickSelection selectTick()                        Thread picked to run this tick
+ *   TickCell tickCell(size_t thread, TickSelection selection, bool created)   Status cell to draw
+ *   bool serviceTick(TickSelection selection, long long time)   Run the tick, true if a task finished
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "SchedulerCommon.h"
+#include "ScheduleTrace.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Thread picked for a tick, hasTask is false when it has nothing to run (or thread is -1)
+struct TickSelection {
+    int thread;
+    bool hasTask;
+};
+
+// One thread's status cell in the timeline
+struct TickCell {
+    const std::string* color;
+    const char* glyph;
+};
+
+struct TickTotals {
+    long long tasksCreated;
+    long long tasksServiced;
+    long long contextSwitches;  // Counted as in SimulationStats
+    long long preemptions;
+    long long overheadTicks;    // Ticks spent on switches
+};
+
+// Renderer for runs without the timeline, everything compiles away
+struct NullRenderer {
+    static constexpr bool draws = false;
+
+    void newFrame() {}
+    void writeCell(const std::string&, const char*) {}
+    void endRow(long long) {}
+    void flush() {}
+};
+
+// Policy that releases through the wrapped policy's releaseArrivals hook, for replaying arrival traces
+// Keeps the replay check out of the regular release hook, which runs for every thread every tick
+template <typename Policy>
+class ArrivalReleases {
+private:
+    Policy& policy;
+public:
+    explicit ArrivalReleases(Policy& wrapped) : policy(wrapped) {}
+
+    int releaseTick(size_t thread, long long time) { return policy.releaseArrivals(thread, time); }
+    size_t releaseQueue(size_t thread) { return policy.releaseQueue(thread); }
+    TickSelection selectTick() { return policy.selectTick(); }
+    TickCell tickCell(size_t thread, TickSelection selection, bool created) {
+        return policy.tickCell(thread, selection, created);
+    }
+    bool serviceTick(TickSelection selection, long long time) { return policy.serviceTick(selection, time); }
+};
+
+// Run horizon ticks of a policy, recording them to trace when it is set
+template <typename Policy, typename Renderer>
+TickTotals runTickEngine(Policy& policy, Renderer& renderer, size_t threadCount, long long horizon, TraceWriter* trace,
+                         const SwitchCosts& costs = SwitchCosts()) {
+    const int frameBoundary = 24;
+    const SwitchCosts switchCosts = costs;  // Copied so the loop doesn't reload it after every hook
+    const bool chargeSwitches = switchCosts.any();
+    TickTotals totals = {0, 0, 0, 0, 0};
+    SwitchTracker switches;
+    std::vector<bool> taskCreated(threadCount, false);  // Which threads released a task this tick
+
+    // Thread that ran last tick and whether its task finished, to spot preemptions
+    int previousThread = -1;
+    bool previousCompleted = false;
+
+    for (long long timeCounter = 0; timeCounter < horizon; ++timeCounter) {
+        if constexpr (Renderer::draws) {
+            if (timeCounter % frameBoundary == 0) {
+                renderer.newFrame();
+            }
+        }
+
+        for (size_t i = 0; i < threadCount; ++i) {
+            int released = policy.releaseTick(i, timeCounter);
+            taskCreated[i] = (released > 0);
+            totals.tasksCreated += released;
+            for (int task = 0; trace != nullptr && task < released; ++task) {
+                trace->recordRelease(policy.releaseQueue(i));
+            }
+        }
+
+        TickSelection selection = policy.selectTick();
+
+        if constexpr (Renderer::draws) {
+            for (size_t i = 0; i < threadCount; ++i) {
+                TickCell cell = policy.tickCell(i, selection, taskCreated[i]);
+                renderer.writeCell(*cell.color, cell.glyph);
+            }
+            renderer.endRow(timeCounter + 1);
+        }
+
+        if (chargeSwitches && selection.hasTask && switches.overheadBefore(selection.thread, switchCosts) > 0) {
+            // The tick goes to the switch, nothing is serviced and the last thread to run stays the same
+            switches.overheadLeft--;
+            totals.overheadTicks++;
+            if (trace != nullptr) {
+                trace->endTick(selection.thread, false, false, false);
+            }
+            continue;
+        }
+
+        bool completed = policy.serviceTick(selection, timeCounter);
+        if (completed) {
+            totals.tasksServiced++;
+        }
+
+        int executedThread = selection.hasTask ? selection.thread : -1;
+        if (executedThread != -1) {
+            switches.record(executedThread, completed, totals.contextSwitches, totals.preemptions);
+        }
+        if (trace != nullptr) {
+            bool preempted = previousThread != -1 && previousThread != executedThread && !previousCompleted;
+            trace->endTick(selection.thread, selection.hasTask, completed, preempted);
+        }
+        previousThread = executedThread;
+        previousCompleted = completed;
+    }
+
+    renderer.flush();
+    return totals;
+}
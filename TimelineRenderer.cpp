@@ -0,0 +1,91 @@
+/**
+ * @file TimelineRenderer.cpp
+ * @brief Timeline renderer implementation.
+ *
+ * Implementation of the buffered, run-length colored timeline renderer.
+ * Output is written straight to the stdout file descriptor in batches.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "TimelineRenderer.h"
+#include "ASCII.h"    // For color codes
+#include <cerrno>
+#include <iostream>
+#include <stdio.h>    // For fflush
+
+#ifdef _WIN32
+#include <io.h>
+#define writeToFd _write
+#define STDOUT_FD 1
+#else
+#include <unistd.h>
+#define writeToFd ::write
+#define STDOUT_FD STDOUT_FILENO
+#endif
+
+// Constructor and Destructor
+TimelineRenderer::TimelineRenderer() {
+    buffer.reserve(flushThreshold * 2);
+}
+
+TimelineRenderer::~TimelineRenderer() {
+    flush();
+}
+
+void TimelineRenderer::setColor(const std::string& colorCode) {
+    if (colorCode != currentColor) {
+        buffer += colorCode;
+        currentColor = colorCode;
+    }
+}
+
+void TimelineRenderer::write(const char* text) {
+    buffer += text;
+}
+
+void TimelineRenderer::writeCell(const std::string& colorCode, const char* glyph) {
+    setColor(colorCode);
+    buffer += glyph;
+}
+
+void TimelineRenderer::newFrame() {
+    setColor(COLOR_WHITE);
+    buffer += "█▓▒░█▓▒░█▓▒░█▓▒░ | New Frame\n";
+}
+
+void TimelineRenderer::endRow(long long timeUnit) {
+    setColor(COLOR_WHITE);
+    buffer += " | ";
+    buffer += std::to_string(timeUnit);
+    buffer += '\n';
+
+    if (buffer.size() >= flushThreshold) {
+        flush();
+    }
+}
+
+// Anything already sent through cout or printf goes first, then the whole buffer in as few writes as possible
+void TimelineRenderer::flush() {
+    if (buffer.empty()) {
+        return;
+    }
+    std::cout.flush();
+    fflush(stdout);
+
+    const char* data = buffer.data();
+    size_t remaining = buffer.size();
+    while (remaining > 0) {
+        long written = static_cast<long>(writeToFd(STDOUT_FD, data, static_cast<unsigned int>(remaining)));
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            break;  // Output closed, drop the rest
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    buffer.clear();
+}
@@ -0,0 +1,38 @@
+/**
+ * @file TimelineRenderer.h
+ * @brief Contains the timeline renderer class definition
+ *
+ * Buffered renderer for the scrolling thread status display.
+ * Rows are built in a reusable buffer, color codes are only written when
+ * the color changes, and the buffer goes to stdout in large writes.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include <cstddef>
+#include <string>
+
+class TimelineRenderer {
+private:
+    std::string buffer;        // Pending output, reused between flushes
+    std::string currentColor;  // Last color code written, empty before the first one
+
+    static const size_t flushThreshold = 64 * 1024;
+public:
+    static constexpr bool draws = true;  // Tells the tick engine to produce cells
+
+    // Constructor and Destructor
+    TimelineRenderer();
+    ~TimelineRenderer();  // Writes out anything still buffered
+
+    void setColor(const std::string& colorCode);  // Only buffered if the color changes
+    void write(const char* text);
+    void writeCell(const std::string& colorCode, const char* glyph);
+
+    void newFrame();                  // Frame boundary banner
+    void endRow(long long timeUnit);  // Time label and newline, flushes once the buffer is large
+
+    void flush();  // Write the buffer to stdout
+};
@@ -0,0 +1,190 @@
+/**
+ * @file Workload.cpp
+ * @brief Seeded workload generator implementation.
+ *
+ * Every arrival draws its tick, then its thread, then its size from one
+ * xoshiro256** stream, so the same options and seed always give the same
+ * arrivals, however the run consumes them.
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "Workload.h"
+#include <algorithm>  // For min
+#include <chrono>
+#include <cmath>      // For floor, isfinite, llround, log, log1p, pow
+#include <random>     // For random_device
+
+static uint64_t splitmix64(uint64_t& seed) {
+    uint64_t value = (seed += 0x9e3779b97f4a7c15ULL);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+static uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+Xoshiro256::Xoshiro256(uint64_t seed) {
+    for (uint64_t& word : state) {
+        word = splitmix64(seed);
+    }
+}
+
+uint64_t Xoshiro256::next() {
+    uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+    uint64_t shifted = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = rotateLeft(state[3], 45);
+    return result;
+}
+
+// Top 53 bits as a fraction, shifted up one step so zero never comes out
+double Xoshiro256::uniform() {
+    return static_cast<double>((next() >> 11) + 1) * 0x1.0p-53;
+}
+
+// Multiply and shift instead of a modulo, the bias is below 2^-32
+uint64_t Xoshiro256::below(uint64_t bound) {
+    return ((next() >> 32) * bound) >> 32;
+}
+
+bool WorkloadOptions::validate(std::string& problem) const {
+    if (!(rate > 0) || !std::isfinite(rate)) {
+        problem = "the arrival rate must be above 0";
+    } else if (process == ArrivalProcess::BERNOULLI && rate > 1) {
+        problem = "a bernoulli workload has at most one arrival per tick, so its rate must be at most 1";
+    } else if (!(meanSize >= 1) || meanSize > maxSize) {
+        problem = "the mean size must be between 1 and " + std::to_string(maxSize);
+    } else if (threadCount < 1 || threadCount > UINT32_MAX) {
+        problem = "a workload needs at least one thread";
+    } else if (!(burstFactor > 1) || !(burstLength > 0)) {
+        problem = "bursts must be above the mean rate and last longer than 0 ticks";
+    } else if (!(paretoShape > 1)) {
+        problem = "the pareto shape must be above 1 for the mean to exist";
+    } else {
+        return true;
+    }
+    return false;
+}
+
+bool parseArrivalProcess(const std::string& text, ArrivalProcess& process) {
+    if (text == "bernoulli") {
+        process = ArrivalProcess::BERNOULLI;
+    } else if (text == "poisson") {
+        process = ArrivalProcess::POISSON;
+    } else if (text == "bursty") {
+        process = ArrivalProcess::BURSTY;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool parseSizeDistribution(const std::string& text, SizeDistribution& sizes) {
+    if (text == "uniform") {
+        sizes = SizeDistribution::UNIFORM;
+    } else if (text == "exponential") {
+        sizes = SizeDistribution::EXPONENTIAL;
+    } else if (text == "pareto") {
+        sizes = SizeDistribution::PARETO;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+uint64_t randomSeed() {
+    std::random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+    uint64_t now = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return seed ^ splitmix64(now);
+}
+
+WorkloadGenerator::WorkloadGenerator(const WorkloadOptions& options)
+    : options(options), random(options.seed), cursor(0), clock(0), burstEnd(0), lastTick(-1) {
+    batch.reserve(batchSize);
+    if (options.process == ArrivalProcess::BURSTY) {
+        burstEnd = -options.burstLength * std::log(random.uniform());  // Runs start in a burst
+    }
+}
+
+long long WorkloadGenerator::nextTick() {
+    switch (options.process) {
+        case ArrivalProcess::BERNOULLI: {
+            // Ticks without an arrival before the next one are geometric, so they are skipped in one draw
+            double skipped = (options.rate >= 1) ? 0 : std::floor(std::log(random.uniform()) / std::log1p(-options.rate));
+            lastTick += 1 + static_cast<long long>(std::min(skipped, 0x1.0p52));
+            return lastTick;
+        }
+        case ArrivalProcess::POISSON:
+            clock -= std::log(random.uniform()) / options.rate;
+            break;
+        case ArrivalProcess::BURSTY: {
+            // Gaps within a burst and the bursts and pauses themselves are exponential, so leftovers can be redrawn
+            double burstRate = options.rate * options.burstFactor;
+            double pauseLength = options.burstLength * (options.burstFactor - 1);
+            double gap = -std::log(random.uniform()) / burstRate;
+            while (clock + gap > burstEnd) {
+                clock = burstEnd - pauseLength * std::log(random.uniform());
+                burstEnd = clock - options.burstLength * std::log(random.uniform());
+                gap = -std::log(random.uniform()) / burstRate;
+            }
+            clock += gap;
+            break;
+        }
+    }
+    return static_cast<long long>(clock);
+}
+
+// Sizes round to the nearest tick, at least 1 and at most maxSize
+int WorkloadGenerator::nextSize() {
+    double size = 1;
+    switch (options.sizes) {
+        case SizeDistribution::UNIFORM: {
+            uint64_t span = static_cast<uint64_t>(std::llround(2 * options.meanSize - 1));
+            return 1 + static_cast<int>(random.below(span));
+        }
+        case SizeDistribution::EXPONENTIAL:
+            size = -options.meanSize * std::log(random.uniform());
+            break;
+        case SizeDistribution::PARETO: {
+            double scale = options.meanSize * (options.paretoShape - 1) / options.paretoShape;
+            size = scale * std::pow(random.uniform(), -1 / options.paretoShape);
+            break;
+        }
+    }
+    if (size >= options.maxSize) {
+        return options.maxSize;
+    }
+    return size < 1.5 ? 1 : static_cast<int>(std::llround(size));
+}
+
+void WorkloadGenerator::fillBatch() {
+    batch.clear();
+    cursor = 0;
+    for (size_t i = 0; i < batchSize; ++i) {
+        Arrival arrival;
+        arrival.tick = nextTick();
+        arrival.thread = (options.threadCount > 1) ? static_cast<size_t>(random.below(options.threadCount)) : 0;
+        arrival.size = nextSize();
+        batch.push_back(arrival);
+    }
+}
+
+bool WorkloadGenerator::next(long long tick, Arrival& arrival) {
+    if (cursor == batch.size()) {
+        fillBatch();
+    }
+    if (batch[cursor].tick > tick) {
+        return false;
+    }
+    arrival = batch[cursor++];
+    return true;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file Workload.h
+ * @brief Contains the seeded workload generator definitions
+ *
+ * Generates task arrivals from a fixed seed, so any run can be repeated
+ * exactly. Arrivals come from a Bernoulli, Poisson or bursty (on/off
+ * Poisson) process over ticks, with uniform, exponential or Pareto task
+ * sizes, and go to a uniformly chosen thread. The generator is an
+ * ArrivalSource, so everything that replays arrival traces can run on it.
+ *
+ * Random numbers come from xoshiro256**, seeded through splitmix64.
+ * Arrivals are generated a batch at a time into a buffer that is handed
+ * out row by row.
+ *
+ * @date 10/16/26
+ * @author Fiya Clerget, Marcello Novak
+ */
+
+#pragma once
+#include "ArrivalTrace.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// xoshiro256** by Blackman and Vigna, small, fast and good enough for simulation
+class Xoshiro256 {
+private:
+    uint64_t state[4];
+public:
+    explicit Xoshiro256(uint64_t seed);  // The state is filled from splitmix64(seed), so any seed works
+
+    uint64_t next();
+    double uniform();                // In (0, 1], safe to take the log of
+    uint64_t below(uint64_t bound);  // In [0, bound), bound under 2^32
+};
+
+enum class ArrivalProcess {
+    BERNOULLI,  // At most one arrival per tick, with probability rate
+    POISSON,    // Exponential gaps between arrivals, rate per tick on average
+    BURSTY      // Poisson at burstFactor times the rate during bursts, nothing between them
+};
+
+enum class SizeDistribution {
+    UNIFORM,      // 1 to 2 * meanSize - 1
+    EXPONENTIAL,  // Exponential, rounded to the nearest tick and at least 1
+    PARETO        // Pareto with shape paretoShape, heavy tailed, rounded to the nearest tick and at least 1
+};
+
+struct WorkloadOptions {
+    ArrivalProcess process = ArrivalProcess::BERNOULLI;
+    SizeDistribution sizes = SizeDistribution::UNIFORM;
+    double rate = 0.2;          // Mean arrivals per tick, over all threads
+    double meanSize = 3.5;      // Mean task size in ticks, 3.5 draws 1 to 6 uniformly
+    size_t threadCount = 1;     // Arrivals go to threads 0 to threadCount - 1
+    uint64_t seed = 1;
+    double burstFactor = 10;    // Rate multiplier during a burst, bursts cover 1 / burstFactor of the time
+    double burstLength = 50;    // Mean burst length in ticks
+    double paretoShape = 1.5;
+    int maxSize = 1 << 20;      // Sizes are capped here, only the Pareto tail gets near it
+
+    // False with a message if a parameter is out of range
+    bool validate(std::string& problem) const;
+};
+
+bool parseArrivalProcess(const std::string& text, ArrivalProcess& process);
+bool parseSizeDistribution(const std::string& text, SizeDistribution& sizes);
+uint64_t randomSeed();  // From the clock and the system's random device, for runs without a given seed
+
+class WorkloadGenerator : public ArrivalSource {
+private:
+    WorkloadOptions options;
+    Xoshiro256 random;
+    std::vector<Arrival> batch;  // Generated but not handed out yet
+    size_t cursor;
+    double clock;                // Continuous time of the last Poisson arrival
+    double burstEnd;             // End of the current burst for BURSTY
+    long long lastTick;          // Tick of the last Bernoulli arrival
+
+    long long nextTick();
+    int nextSize();
+    void fillBatch();
+public:
+    static const size_t batchSize = 4096;
+
+    explicit WorkloadGenerator(const WorkloadOptions& options);  // Options must have passed validate
+
+    bool next(long long tick, Arrival& arrival);
+};
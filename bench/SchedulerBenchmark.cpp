@@ -0,0 +1,446 @@
+/**
+ * @file SchedulerBenchmark.cpp
+ * @brief Container and scheduler benchmark suite
+ *
+ * Micro benchmarks for Queue, Stack and RingQueue push/pop, and macro
+ * benchmarks for whole rate monotonic and round robin runs: the STRUCTURED
+ * and STARVED examples tick by tick and event-driven, the same examples as
+ * compile time task sets, the round robin examples with the adaptive
+ * quantum and under the multilevel feedback queue, and generated thread
+ * sets from 4 to 100k threads.
+ * The release countdown's vector pass is timed against the scalar one and
+ * against the modulo test it replaced, after checking they release alike.
+ * Rate monotonic is first checked to run the same on sparse priorities up
+ * to the int limit as on dense ones, and a trace with several releases on
+ * one thread in a tick to read back as written.
+ * The workload generator is timed per generated arrival.
+ * Nothing is rendered. Prints a table, and with
+ * --json FILE also writes the results as JSON for comparing commits.
+ *
+ * Usage: scheduler_bench [--json FILE] [--repeat N] [--quick]
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "EarliestDeadlineFirst.h"
+#include "Multicore.h"
+#include "MultilevelFeedbackQueue.h"
+#include "Queue.h"
+#include "RateMonotonic.h"
+#include "ReleaseCountdown.h"
+#include "RingQueue.h"
+#include "RoundRobin.h"
+#include "ScheduleTrace.h"
+#include "Stack.h"
+#include "StaticScheduler.h"
+#include "ThreadSet.h"
+#include "Workload.h"
+#include <algorithm>  // For max, min
+#include <bitset>     // For counting mask bits
+#include <chrono>
+#include <stdio.h>   // For printf, FILE, remove
+#include <stdlib.h>  // For atoi
+#include <string>
+#include <vector>
+
+// One measured benchmark, the best of all repeats
+struct BenchmarkResult {
+    std::string name;
+    std::string group;     // "container", "scheduler", "workload" or "kernel"
+    size_t threads;        // Thread count for scheduler runs, 0 for containers
+    long long horizon;     // Ticks simulated for scheduler runs, 0 for containers
+    long long operations;  // Container operations, ticks for scheduler runs, or arrivals for workloads
+    long long tasks;       // Tasks created, -1 when the run doesn't report it
+    double seconds;
+};
+
+static std::vector<BenchmarkResult> results;
+static int repeatCount = 3;
+static volatile long long sink;  // Keeps the optimizer from dropping benchmark work
+
+// Run body repeatCount times and keep the fastest, body returns the task count or -1
+template <typename Body>
+static void measure(const std::string& name, const char* group, size_t threads, long long horizon,
+                    long long operations, Body body) {
+    double best = 0;
+    long long tasks = -1;
+    for (int i = 0; i < repeatCount; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        tasks = body();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = (i == 0) ? seconds : min(best, seconds);
+    }
+
+    results.push_back({name, group, threads, horizon, operations, tasks, best});
+    printf("%-34s %8zu %10lld %12lld %10.4f %10.2f\n", name.c_str(), threads, horizon, operations, best,
+           best * 1e9 / static_cast<double>(operations > 0 ? operations : 1));
+}
+
+// Fill to depth then cycle tasks through at that depth, like a task queue under load
+template <typename Container>
+static long long containerWorkload(long long operations, int depth) {
+    Container container;
+    long long checksum = 0;
+    for (int i = 0; i < depth; ++i) {
+        container.push(Task(i));
+    }
+    for (long long i = 0; i < operations; ++i) {
+        container.push(Task(static_cast<int>(i)));
+        checksum += container.top()->getRequested();
+        container.pop();
+    }
+    while (!container.isEmpty()) {
+        container.pop();
+    }
+    sink = checksum;
+    return -1;
+}
+
+template <typename Container>
+static void benchmarkContainer(const char* name, long long operations) {
+    const int depths[] = {1, 64, 4096};
+    for (int depth : depths) {
+        measure(std::string(name) + " push/top/pop depth " + std::to_string(depth), "container", 0, 0, operations,
+                [&]() { return containerWorkload<Container>(operations, depth); });
+    }
+}
+
+// Pull arrivals off a generator at one per tick on average, as the schedulers do
+static void benchmarkWorkload(const char* name, ArrivalProcess process, SizeDistribution sizes, long long arrivals) {
+    measure(std::string("WORKLOAD ") + name, "workload", 4, 0, arrivals, [&]() {
+        WorkloadOptions options;
+        options.process = process;
+        options.sizes = sizes;
+        options.rate = 1;
+        options.threadCount = 4;
+        WorkloadGenerator generator(options);
+        Arrival arrival;
+        long long checksum = 0;
+        for (long long taken = 0, tick = 0; taken < arrivals; ++tick) {
+            while (taken < arrivals && generator.next(tick, arrival)) {
+                checksum += arrival.size;
+                taken++;
+            }
+        }
+        sink = checksum;
+        return arrivals;
+    });
+}
+
+// Tick by tick run with the display off, the same loop the timeline uses
+template <typename Scheduler>
+static void benchmarkTicks(const std::string& name, const std::vector<Thread>& threadSet, long long horizon) {
+    measure(name + " ticks", "scheduler", threadSet.size(), horizon, horizon, [&]() {
+        Scheduler scheduler(threadSet);
+        scheduler.runTicks(horizon, OutputLevel::NONE);
+        return -1LL;
+    });
+}
+
+// Round robin tick by tick with each thread's quantum sized from its estimated demand
+static void benchmarkAdaptiveTicks(const std::string& name, const std::vector<Thread>& threadSet, long long horizon) {
+    measure(name + " adaptive ticks", "scheduler", threadSet.size(), horizon, horizon, [&]() {
+        RoundRobinScheduler scheduler(threadSet);
+        scheduler.setAdaptiveQuantum(true);
+        scheduler.runTicks(horizon, OutputLevel::NONE);
+        return -1LL;
+    });
+}
+
+// Tick by tick run of a compile time task set, stepping through its release calendar
+template <typename StaticScheduler>
+static void benchmarkStaticTicks(const std::string& name, size_t threadCount, long long horizon) {
+    measure(name + " static ticks", "scheduler", threadCount, horizon, horizon, [&]() {
+        StaticScheduler scheduler;
+        scheduler.runTicks(horizon, OutputLevel::NONE);
+        return -1LL;
+    });
+}
+
+// Event-driven run, only the ticks where something changes are visited
+template <typename Scheduler>
+static void benchmarkSimulate(const std::string& name, const std::vector<Thread>& threadSet, long long horizon) {
+    measure(name + " simulate", "scheduler", threadSet.size(), horizon, horizon, [&]() {
+        Scheduler scheduler(threadSet);
+        return scheduler.simulate(horizon).tasksCreated;
+    });
+}
+
+// Tick by tick run on several simulated CPUs
+static void benchmarkMulticore(const std::string& name, const std::vector<Thread>& threadSet, long long horizon,
+                               CorePolicy policy, CorePlacement placement, size_t cpuCount) {
+    measure(name + " " + std::to_string(cpuCount) + " cpus", "scheduler", threadSet.size(), horizon, horizon, [&]() {
+        MulticoreScheduler scheduler(threadSet, policy, placement, cpuCount);
+        return scheduler.runTicks(horizon, OutputLevel::NONE).totals.tasksCreated;
+    });
+}
+
+static long long countReleased(const ReleaseCountdown& releases) {
+    long long count = 0;
+    for (uint64_t word : releases.releaseMask()) {
+        count += static_cast<long long>(std::bitset<64>(word).count());
+    }
+    return count;
+}
+
+// Release checks alone, every thread every tick, false if the vector pass and the scalar one ever disagree
+static bool benchmarkReleases(const std::string& label, const std::vector<Thread>& threadSet, long long ticks) {
+    std::vector<int> periods;
+    for (const Thread& thread : threadSet) {
+        periods.push_back(thread.frequency);
+    }
+    long long checks = ticks * static_cast<long long>(periods.size());
+
+    ReleaseCountdown vectorPass, scalarPass;
+    vectorPass.reset(periods);
+    scalarPass.reset(periods);
+    for (long long tick = 0; tick < ticks; ++tick) {
+        vectorPass.advance();
+        scalarPass.advanceScalar();
+        if (vectorPass.releaseMask() != scalarPass.releaseMask()) {
+            printf("Error: the %s release pass differs from the scalar one at tick %lld\n",
+                   ReleaseCountdown::instructionSet(), tick);
+            return false;
+        }
+    }
+
+    measure("releases modulo " + label, "kernel", periods.size(), ticks, checks, [&]() {
+        long long count = 0;
+        for (long long tick = 0; tick < ticks; ++tick) {
+            for (int period : periods) {
+                count += (tick % period == 0);
+            }
+        }
+        sink = count;
+        return count;
+    });
+    measure("releases scalar " + label, "kernel", periods.size(), ticks, checks, [&]() {
+        ReleaseCountdown releases;
+        releases.reset(periods);
+        long long count = 0;
+        for (long long tick = 0; tick < ticks; ++tick) {
+            releases.advanceScalar();
+            count += countReleased(releases);
+        }
+        sink = count;
+        return count;
+    });
+    measure(std::string("releases ") + ReleaseCountdown::instructionSet() + " " + label, "kernel",
+            periods.size(), ticks, checks, [&]() {
+        ReleaseCountdown releases;
+        releases.reset(periods);
+        long long count = 0;
+        for (long long tick = 0; tick < ticks; ++tick) {
+            releases.advance();
+            count += countReleased(releases);
+        }
+        sink = count;
+        return count;
+    });
+    return true;
+}
+
+// Rate monotonic on priorities spread up to the int limit must run exactly as on the same order numbered densely,
+// false if it doesn't, a shared priority included so its tasks still go to the first thread that has it
+static bool checkSparsePriorities(long long horizon) {
+    std::vector<Thread> dense = {{1, 1, 4}, {2, 1, 6}, {2, 2, 12}, {3, 1, 8}};
+    std::vector<Thread> sparse = {{1, 1, 4}, {1000000, 1, 6}, {1000000, 2, 12}, {2000000000, 1, 8}};
+
+    RateMonotonicScheduler denseTicks(dense), sparseTicks(sparse);
+    TickTotals denseTotals = denseTicks.runTicks(horizon, OutputLevel::NONE);
+    TickTotals sparseTotals = sparseTicks.runTicks(horizon, OutputLevel::NONE);
+    RateMonotonicScheduler denseEvents(dense), sparseEvents(sparse);
+    SimulationStats denseStats = denseEvents.simulate(horizon);
+    SimulationStats sparseStats = sparseEvents.simulate(horizon);
+
+    if (denseTotals.tasksServiced != sparseTotals.tasksServiced ||
+        denseTotals.contextSwitches != sparseTotals.contextSwitches ||
+        denseStats.tasksServiced != sparseStats.tasksServiced || denseStats.deadlineMisses != sparseStats.deadlineMisses ||
+        denseStats.contextSwitches != sparseStats.contextSwitches) {
+        printf("Error: rate monotonic runs differently on sparse priorities\n");
+        return false;
+    }
+    return true;
+}
+
+// A trace with several releases on one thread in a tick, as arrival replays record, must read back as written,
+// false if it doesn't or the file can't be written
+static bool checkTraceReleases(const std::string& path) {
+    const std::vector<std::vector<size_t>> written = {{0, 0, 0, 1}, {}, {1, 1}};
+    TraceWriter writer;
+    if (!writer.open(path, TraceScheduler::RATE_MONOTONIC, 2)) {
+        return false;
+    }
+    for (const std::vector<size_t>& releases : written) {
+        for (size_t threadIndex : releases) {
+            writer.recordRelease(threadIndex);
+        }
+        writer.endTick(0, true, true, false);
+    }
+    if (!writer.close()) {
+        return false;
+    }
+
+    TraceReader reader;
+    bool same = reader.open(path) && reader.tickCount() == static_cast<long long>(written.size());
+    TraceTick tick;
+    for (size_t i = 0; same && i < written.size(); ++i) {
+        same = reader.next(tick) && tick.releases == written[i];
+    }
+    same = same && reader.pending() == std::vector<long long>{1, 3};
+    remove(path.c_str());
+    if (!same) {
+        printf("Error: a trace with several releases per thread in a tick doesn't read back as written\n");
+    }
+    return same;
+}
+
+// Both run styles for the two built in examples of a scheduler
+template <typename Scheduler>
+static void benchmarkExamples(const char* name, long long horizon) {
+    std::vector<Thread> structured = Scheduler::exampleThreadSet(ExampleType::STRUCTURED);
+    std::vector<Thread> starved = Scheduler::exampleThreadSet(ExampleType::STARVED);
+
+    benchmarkTicks<Scheduler>(std::string(name) + " STRUCTURED", structured, horizon);
+    benchmarkSimulate<Scheduler>(std::string(name) + " STRUCTURED", structured, horizon);
+    benchmarkTicks<Scheduler>(std::string(name) + " STARVED", starved, horizon);
+    benchmarkSimulate<Scheduler>(std::string(name) + " STARVED", starved, horizon);
+}
+
+static void writeJsonString(FILE* file, const std::string& text) {
+    fputc('"', file);
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            fputc('\\', file);
+        }
+        fputc(c, file);
+    }
+    fputc('"', file);
+}
+
+static bool writeJson(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        printf("Could not open %s for writing\n", path.c_str());
+        return false;
+    }
+
+    fprintf(file, "{\n  \"repeat\": %d,\n  \"benchmarks\": [\n", repeatCount);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& result = results[i];
+        double perOperation = result.seconds * 1e9 / static_cast<double>(max(result.operations, 1LL));
+        fprintf(file, "    {\"name\": ");
+        writeJsonString(file, result.name);
+        fprintf(file, ", \"group\": \"%s\", \"threads\": %zu, \"horizon\": %lld, \"operations\": %lld, ",
+                result.group.c_str(), result.threads, result.horizon, result.operations);
+        if (result.tasks >= 0) {
+            fprintf(file, "\"tasks\": %lld, ", result.tasks);
+        }
+        fprintf(file, "\"seconds\": %.9f, \"ns_per_op\": %.3f, \"ops_per_second\": %.1f}%s\n", result.seconds,
+                perOperation, 1e9 / max(perOperation, 1e-9), i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+
+    bool written = !ferror(file);
+    written = (fclose(file) == 0) && written;
+    if (!written) {
+        printf("Could not write %s\n", path.c_str());
+    }
+    return written;
+}
+
+int main(int argc, char* argv[]) {
+    std::string jsonPath;
+    bool quick = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--json" && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (option == "--repeat" && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            repeatCount = atoi(argv[++i]);
+        } else if (option == "--quick") {
+            quick = true;
+        } else {
+            printf("Usage: scheduler_bench [--json FILE] [--repeat N] [--quick]\n");
+            return 1;
+        }
+    }
+
+    // --quick shrinks the long runs tenfold for a fast smoke check
+    long long scale = quick ? 10 : 1;
+
+    if (!checkSparsePriorities(10008) || !checkTraceReleases("scheduler_bench_check.trc")) {
+        return 1;
+    }
+
+    printf("%-34s %8s %10s %12s %10s %10s\n", "benchmark", "threads", "horizon", "operations", "seconds", "ns/op");
+
+    long long containerOperations = 10000000 / scale;
+    benchmarkContainer<Queue>("Queue", containerOperations);
+    benchmarkContainer<Stack>("Stack", containerOperations);
+    benchmarkContainer<RingQueue<Task>>("RingQueue", containerOperations);
+
+    long long workloadArrivals = 10000000 / scale;
+    benchmarkWorkload("bernoulli uniform", ArrivalProcess::BERNOULLI, SizeDistribution::UNIFORM, workloadArrivals);
+    benchmarkWorkload("poisson exponential", ArrivalProcess::POISSON, SizeDistribution::EXPONENTIAL, workloadArrivals);
+    benchmarkWorkload("bursty pareto", ArrivalProcess::BURSTY, SizeDistribution::PARETO, workloadArrivals);
+
+    const long long horizons[] = {10008, 1000000 / scale};
+    for (long long horizon : horizons) {
+        benchmarkExamples<RateMonotonicScheduler>("RM", horizon);
+        benchmarkExamples<RoundRobinScheduler>("RR", horizon);
+        benchmarkExamples<EDFScheduler>("EDF", horizon);
+
+        // The same examples as constexpr tables, against the runtime configured ticks runs above
+        benchmarkStaticTicks<StaticRateMonotonicScheduler<rateMonotonicStructured>>("RM STRUCTURED", 4, horizon);
+        benchmarkStaticTicks<StaticRateMonotonicScheduler<rateMonotonicStarved>>("RM STARVED", 4, horizon);
+        benchmarkStaticTicks<StaticRoundRobinScheduler<roundRobinStructured>>("RR STRUCTURED", 4, horizon);
+        benchmarkStaticTicks<StaticRoundRobinScheduler<roundRobinStarved>>("RR STARVED", 4, horizon);
+
+        // The round robin examples again, with adaptive quanta and with tasks moving between feedback levels
+        benchmarkAdaptiveTicks("RR STRUCTURED", RoundRobinScheduler::exampleThreadSet(ExampleType::STRUCTURED), horizon);
+        benchmarkAdaptiveTicks("RR STARVED", RoundRobinScheduler::exampleThreadSet(ExampleType::STARVED), horizon);
+        benchmarkTicks<MLFQScheduler>("MLFQ STRUCTURED", MLFQScheduler::exampleThreadSet(ExampleType::STRUCTURED), horizon);
+        benchmarkTicks<MLFQScheduler>("MLFQ STARVED", MLFQScheduler::exampleThreadSet(ExampleType::STARVED), horizon);
+    }
+
+    // Thread count scaling on generated sets, tick by tick only where it stays affordable
+    const size_t threadCounts[] = {4, 64, 1024, 16384, 100000};
+    for (size_t threadCount : threadCounts) {
+        std::vector<Thread> threadSet = generateThreadSet(threadCount);
+
+        // Cover at least a million ticks and two of the longest periods
+        long long horizon = 1000000 / scale;
+        for (const Thread& thread : threadSet) {
+            horizon = max(horizon, 2LL * thread.frequency);
+        }
+
+        std::string label = "generated " + std::to_string(threadCount);
+        if (threadCount <= 64) {
+            benchmarkTicks<RateMonotonicScheduler>("RM " + label, threadSet, horizon);
+            benchmarkTicks<RoundRobinScheduler>("RR " + label, threadSet, horizon);
+            benchmarkTicks<EDFScheduler>("EDF " + label, threadSet, horizon);
+            benchmarkMulticore("RM partitioned " + label, threadSet, horizon, CorePolicy::RATE_MONOTONIC,
+                               CorePlacement::PARTITIONED, 4);
+            benchmarkMulticore("RM global " + label, threadSet, horizon, CorePolicy::RATE_MONOTONIC, CorePlacement::GLOBAL, 4);
+            benchmarkMulticore("RR global " + label, threadSet, horizon, CorePolicy::ROUND_ROBIN, CorePlacement::GLOBAL, 4);
+        }
+        benchmarkSimulate<RateMonotonicScheduler>("RM " + label, threadSet, horizon);
+        benchmarkSimulate<RoundRobinScheduler>("RR " + label, threadSet, horizon);
+        benchmarkSimulate<EDFScheduler>("EDF " + label, threadSet, horizon);
+
+        // Release checks alone, about as many at every size
+        if (threadCount >= 64) {
+            long long releaseTicks = max(100000000 / scale / static_cast<long long>(threadCount), 1LL);
+            if (!benchmarkReleases(label, threadSet, releaseTicks)) {
+                return 1;
+            }
+        }
+    }
+
+    if (!jsonPath.empty() && !writeJson(jsonPath)) {
+        return 1;
+    }
+    return 0;
+}
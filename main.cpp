@@ -4,6 +4,7 @@
  *
  * Main scheduler demo function.
  * Allows the user to select and run either the Stack, Queue, or Rate Monotonic Structured scheduler example.
+ * With command line options it runs one scheduler or a parameter sweep without the menu, see displayUsage.
  *
  * @date 10/31/24
  * @authors
@@ -15,8 +16,23 @@
 #include "Queue.h"
 #include "RateMonotonic.h" // Include Rate Monotonic Scheduler
 #include "RoundRobin.h"    // Include Round Robin Scheduler
+#include "EarliestDeadlineFirst.h" // Include Earliest Deadline First Scheduler
+#include "MultilevelFeedbackQueue.h" // Include Multilevel Feedback Queue Scheduler
+#include "Multicore.h"     // Include the multicore scheduler
+#include "Runtime.h"       // Include the periodic runtime
 #include "ASCII.h"         // Include ASCII color codes
+#include "ThreadSet.h"     // Include thread set loading
+#include "OutputLevel.h"   // Include output levels
+#include "ScheduleTrace.h" // Include trace recording
+#include "ArrivalTrace.h"  // Include arrival trace replay
+#include "Workload.h"      // Include generated workloads
+#include "ParameterSweep.h" // Include parameter sweeps
+#include "Schedulability.h" // Include rate monotonic analysis
+#include <chrono>
 #include <iostream> 
+#include <stdio.h>         // For printf
+#include <stdlib.h>        // For strtoll, strtoull, strtod
+#include <string>
 
 void displayMenu() {
     std::cout << "Select a scheduler to run:" << std::endl;
@@ -24,6 +40,8 @@ void displayMenu() {
     std::cout << "Q - Queue" << std::endl;
     std::cout << "1 - Rate Monotonic" << std::endl;
     std::cout << "2 - Round Robin" << std::endl;
+    std::cout << "3 - Earliest Deadline First" << std::endl;
+    std::cout << "4 - Multilevel Feedback Queue" << std::endl;
     std::cout << "K - Print Color Key" << std::endl;  // Added option
     std::cout << "E - Exit" << std::endl;
 }
@@ -32,12 +50,36 @@ void displayRateMonotonicOptions() {
     std::cout << "Select a Rate Monotonic example to run:" << std::endl;
     std::cout << "1 - Structured" << std::endl;
     std::cout << "2 - Starved" << std::endl;
+    std::cout << "3 - Load thread set from file" << std::endl;
 }
 
 void displayRoundRobinOptions() {
     std::cout << "Select a Round Robin example to run:" << std::endl;
     std::cout << "1 - Structured" << std::endl;
     std::cout << "2 - Starved" << std::endl;
+    std::cout << "3 - Load thread set from file" << std::endl;
+}
+
+void displayEarliestDeadlineFirstOptions() {
+    std::cout << "Select an Earliest Deadline First example to run:" << std::endl;
+    std::cout << "1 - Structured" << std::endl;
+    std::cout << "2 - Starved" << std::endl;
+    std::cout << "3 - Load thread set from file" << std::endl;
+}
+
+void displayFeedbackQueueOptions() {
+    std::cout << "Select a Multilevel Feedback Queue example to run:" << std::endl;
+    std::cout << "1 - Structured" << std::endl;
+    std::cout << "2 - Starved" << std::endl;
+    std::cout << "3 - Load thread set from file" << std::endl;
+}
+
+// Ask for a thread set file, returns false if it could not be loaded
+bool promptThreadSet(std::vector<Thread>& threadSet) {
+    std::string path;
+    std::cout << "Enter thread set file path: ";
+    std::cin >> path;
+    return loadThreadSet(path, threadSet);
 }
 
 void displayColorKey() {
@@ -79,8 +121,677 @@ void displayColorKey() {
     std::cout << ": Time unit run without task\n" << std::endl;
 }
 
-int main() {
+void displayUsage() {
+    std::cout << "Usage: scheduler [options]" << std::endl;
+    std::cout << "With no options the interactive menu is shown." << std::endl;
+    std::cout << "  --scheduler stack|queue|rm|rr|edf|mlfq   Scheduler to run" << std::endl;
+    std::cout << "  --example structured|starved        Built-in thread set for rm, rr, edf and mlfq (default structured)" << std::endl;
+    std::cout << "  --taskset FILE                      Thread set file for rm, rr, edf and mlfq, one \"priority size frequency\" per line" << std::endl;
+    std::cout << "  --horizon N                         Time units to simulate (default 10001 for stack/queue, 10008 for rm/rr)" << std::endl;
+    std::cout << "  --output none|summary|timeline      How much to print (default summary)" << std::endl;
+    std::cout << "  --output latency                    Totals and each thread's response, waiting and lateness p50/p99/max (rm, rr, edf, mlfq)" << std::endl;
+    std::cout << "  --trace FILE                        Record a binary trace of an rm or rr run for trace_replay" << std::endl;
+    std::cout << "  --arrivals FILE                     Replay tick,thread,size arrivals from a CSV or binary trace (stack, queue, rm, rr, mlfq)" << std::endl;
+    std::cout << "  --workload bernoulli|poisson|bursty Generate arrivals instead (stack, queue, rm, rr, mlfq, default bernoulli for stack/queue)" << std::endl;
+    std::cout << "  --rate R                            Mean generated arrivals per time unit over all threads (default 0.2)" << std::endl;
+    std::cout << "  --sizes uniform|exponential|pareto  Generated task size distribution (default uniform)" << std::endl;
+    std::cout << "  --mean-size S                       Mean generated task size (default 3.5, uniform 1 to 6)" << std::endl;
+    std::cout << "  --seed N                            Seed of the generated arrivals, the same seed repeats the run (default random)" << std::endl;
+    std::cout << "  --analyze                           Decide rm schedulability analytically, simulating only if undecided" << std::endl;
+    std::cout << "  --cpus N                            Run rm or rr on N simulated CPUs" << std::endl;
+    std::cout << "  --placement partitioned|global      Keep threads on their CPU, or let idle CPUs steal them (default partitioned)" << std::endl;
+    std::cout << "  --compare                           Run the rm/edf thread set under both and compare throughput and deadline misses," << std::endl;
+    std::cout << "                                      the mlfq thread set under mlfq and rr, or the rr one under a fixed and the adaptive" << std::endl;
+    std::cout << "                                      quantum, and compare response times and context switches" << std::endl;
+    std::cout << "  --quantum N|adaptive                Round robin quantum, or the top mlfq level's (default 4 for rr, 2 for mlfq)," << std::endl;
+    std::cout << "                                      adaptive sizes each rr thread's turn from its recent task sizes" << std::endl;
+    std::cout << "  --levels N                          Mlfq levels, each quantum twice the one above (default 3, at most 16)" << std::endl;
+    std::cout << "  --boost N                           Time units between moving every mlfq task back to the top, 0 never (default 100)" << std::endl;
+    std::cout << "  --switch-cost N                     Time units every rm or rr context switch takes from the CPU (default 0)" << std::endl;
+    std::cout << "  --refill-cost N                     Time units added to switches that preempt a task, for refilling its cache (default 0)" << std::endl;
+    std::cout << "Any --sweep option runs every combination of the ranges instead, given as A, A:B or A:B:STEP." << std::endl;
+    std::cout << "Each combination is that many identical threads, rm and rr both run unless --scheduler picks one." << std::endl;
+    std::cout << "  --sweep-threads RANGE               Thread counts (default 4)" << std::endl;
+    std::cout << "  --sweep-size RANGE                  Task sizes (default 1)" << std::endl;
+    std::cout << "  --sweep-frequency RANGE             Release periods (default 8)" << std::endl;
+    std::cout << "  --sweep-quantum RANGE               Round robin quanta (default 4)" << std::endl;
+    std::cout << "  --workers N                         Sweep or runtime worker threads (default one per hardware thread)" << std::endl;
+    std::cout << "  --runtime                           Run rm or rr thread sets for real, each task spinning for size ticks" << std::endl;
+    std::cout << "  --tick-us N                         Runtime tick length in microseconds (default 100)" << std::endl;
+    std::cout << "  --help                              Show this message" << std::endl;
+}
+
+// Parse a non-negative count, returns false if the text isn't one
+bool parseCount(const std::string& text, long long& value) {
+    char* end = nullptr;
+    value = strtoll(text.c_str(), &end, 10);
+    return !text.empty() && *end == '\0' && value >= 0;
+}
+
+bool parseRate(const std::string& text, double& value) {
+    char* end = nullptr;
+    value = strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0';
+}
+
+// Finish the workload options for threadCount threads, prints the seed so the run can be repeated
+bool prepareWorkload(WorkloadOptions& workload, size_t threadCount, OutputLevel output) {
+    workload.threadCount = threadCount;
+    std::string problem;
+    if (!workload.validate(problem)) {
+        std::cerr << "Invalid workload: " << problem << std::endl;
+        return false;
+    }
+    if (output != OutputLevel::NONE) {
+        std::cout << "Workload seed: " << workload.seed << std::endl;
+    }
+    return true;
+}
+
+// Run one thread set under rate monotonic and earliest deadline first and print them side by side
+void compareDeadlineSchedulers(const std::vector<Thread>& threadSet, long long horizon) {
+    printf("%-4s %14s %14s %14s %14s %14s %8s %10s\n", "algo", "created", "serviced", "backlog", "due", "misses", "miss %",
+           "run ms");
+    for (int algorithm = 0; algorithm < 2; ++algorithm) {
+        auto start = std::chrono::steady_clock::now();
+        SimulationStats stats;
+        if (algorithm == 0) {
+            RateMonotonicScheduler rmsScheduler(threadSet);
+            stats = rmsScheduler.simulate(horizon);
+        } else {
+            EDFScheduler edfScheduler(threadSet);
+            stats = edfScheduler.simulate(horizon);
+        }
+        double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        // Misses include tasks still queued past their deadline, out of every task due within the horizon
+        double missPercent = stats.tasksDue > 0 ? 100.0 * stats.deadlineMisses / stats.tasksDue : 0.0;
+        printf("%-4s %14lld %14lld %14lld %14lld %14lld %8.2f %10.3f\n", algorithm == 0 ? "RM" : "EDF", stats.tasksCreated,
+               stats.tasksServiced, stats.tasksCreated - stats.tasksServiced, stats.tasksDue, stats.deadlineMisses,
+               missPercent, milliseconds);
+    }
+}
+
+// Arrivals read again from a trace or regenerated from a workload's seed, so another run sees the same ones
+// source stays nullptr for runs with periodic releases
+struct RepeatedArrivals {
+    ArrivalTraceReader reader;
+    WorkloadGenerator generator;
+    ArrivalSource* source = nullptr;
+
+    explicit RepeatedArrivals(const WorkloadOptions* workload)
+        : generator(workload != nullptr ? *workload : WorkloadOptions()) {
+        if (workload != nullptr) {
+            source = &generator;
+        }
+    }
+
+    // False if the trace can't be opened
+    bool open(const std::string& arrivalsPath) {
+        if (arrivalsPath.empty()) {
+            return true;
+        }
+        source = &reader;
+        return reader.open(arrivalsPath);
+    }
+};
+
+// Tasks serviced by the same rm or rr run with free switches, -1 if its arrivals couldn't be read
+long long servicedWithoutSwitchCosts(bool rateMonotonic, const std::vector<Thread>& threadSet, long long horizon,
+                                     long long quantum, bool adaptiveQuantum, const std::string& arrivalsPath,
+                                     const WorkloadOptions* workload) {
+    RepeatedArrivals arrivals(workload);
+    if (!arrivals.open(arrivalsPath)) {
+        return -1;
+    }
+
+    long long serviced;
+    if (rateMonotonic) {
+        RateMonotonicScheduler rmsScheduler(threadSet);
+        rmsScheduler.setArrivals(arrivals.source);
+        serviced = (arrivals.source != nullptr) ? rmsScheduler.runTicks(horizon, OutputLevel::NONE).tasksServiced
+                                                : rmsScheduler.simulate(horizon).tasksServiced;
+    } else {
+        RoundRobinScheduler rrScheduler(threadSet);
+        if (quantum > 0) {
+            rrScheduler.setTimeQuantum(static_cast<int>(quantum));
+        }
+        rrScheduler.setAdaptiveQuantum(adaptiveQuantum);
+        rrScheduler.setArrivals(arrivals.source);
+        serviced = (arrivals.source != nullptr) ? rrScheduler.runTicks(horizon, OutputLevel::NONE).tasksServiced
+                                                : rrScheduler.simulate(horizon).tasksServiced;
+    }
+    return arrivals.reader.hasFailed() ? -1 : serviced;
+}
+
+// Run two tick by tick schedulers on one thread set and print their response times and switches side by side
+// Both runs see the same arrivals, a trace is read again and a workload regenerated from its seed
+template <typename First, typename Second>
+int compareResponseTimes(const std::string& firstName, First& first, const std::string& secondName, Second& second,
+                         long long horizon, const std::string& arrivalsPath, const WorkloadOptions* workload) {
+    printf("%-12s %14s %14s %14s %12s %12s %10s %10s %10s %10s\n", "algo", "created", "serviced", "backlog", "switches",
+           "preempts", "resp mean", "resp max", "wait mean", "run ms");
+    for (int algorithm = 0; algorithm < 2; ++algorithm) {
+        RepeatedArrivals arrivals(workload);
+        if (!arrivals.open(arrivalsPath)) {
+            return 1;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        TickTotals totals;
+        const std::vector<ThreadLatency>* latencies;
+        if (algorithm == 0) {
+            first.setArrivals(arrivals.source);
+            totals = first.runTicks(horizon, OutputLevel::NONE);
+            latencies = &first.latencies();
+        } else {
+            second.setArrivals(arrivals.source);
+            totals = second.runTicks(horizon, OutputLevel::NONE);
+            latencies = &second.latencies();
+        }
+        double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (arrivals.reader.hasFailed()) {
+            return 1;
+        }
+
+        long long finished = 0, responseSum = 0, responseMax = 0, waitingSum = 0;
+        for (const ThreadLatency& latency : *latencies) {
+            finished += latency.response.count();
+            responseSum += latency.response.sum();
+            responseMax = std::max(responseMax, latency.response.max());
+            waitingSum += latency.waiting.sum();
+        }
+        double divisor = finished > 0 ? static_cast<double>(finished) : 1.0;
+        printf("%-12s %14lld %14lld %14lld %12lld %12lld %10.2f %10lld %10.2f %10.3f\n",
+               (algorithm == 0 ? firstName : secondName).c_str(), totals.tasksCreated, totals.tasksServiced,
+               totals.tasksCreated - totals.tasksServiced, totals.contextSwitches, totals.preemptions, responseSum / divisor,
+               responseMax, waitingSum / divisor, milliseconds);
+    }
+    return 0;
+}
+
+// Run a thread set on worker threads, every task spinning for its size in ticks
+void runRuntimeCommand(const std::string& schedulerName, const std::vector<Thread>& threadSet, long long horizon,
+                       long long tickMicros, unsigned workers, OutputLevel output) {
+    std::chrono::microseconds tick(tickMicros);
+    PeriodicRuntime runtime(threadSet, schedulerName == "rm" ? CorePolicy::RATE_MONOTONIC : CorePolicy::ROUND_ROBIN, workers);
+    for (size_t i = 0; i < threadSet.size(); ++i) {
+        std::chrono::nanoseconds duration = threadSet[i].size * tick;
+        runtime.bind(i, [duration]() { spinFor(duration); });
+    }
+
+    RuntimeStats stats = runtime.run(horizon, tick);
+    if (output != OutputLevel::NONE) {
+        printRuntimeStats(stats, runtime.workerCount());
+    }
+}
+
+// Run a parameter sweep and print the table, returns the exit code
+int runSweepCommand(const std::string& schedulerName, SweepOptions& options, long long horizon) {
+    if (schedulerName == "rm") {
+        options.roundRobin = false;
+    } else if (schedulerName == "rr") {
+        options.rateMonotonic = false;
+    } else if (!schedulerName.empty()) {
+        std::cerr << "Sweeps only run rm and rr" << std::endl;
+        return 1;
+    }
+    if (horizon >= 0) {
+        options.horizon = horizon;
+    }
+
+    unsigned workersUsed = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<SweepPoint> points = runSweep(options, workersUsed);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printSweep(points, options);
+    std::cout << points.size() << " simulations of " << options.horizon << " ticks on " << workersUsed
+              << " workers in " << seconds << " s" << std::endl;
+    return 0;
+}
+
+// Run one scheduler as described by the command line options, returns the exit code
+int runCommandLine(int argc, char* argv[]) {
+    std::string schedulerName;
+    std::string exampleName = "structured";
+    std::string threadSetPath;
+    std::string outputName = "summary";
+    std::string tracePath;
+    std::string arrivalsPath;
+    std::string placementName = "partitioned";
+    long long horizon = -1;
+    long long cpuCount = 0;
+    long long tickMicros = 100;
+    long long quantum = 0;       // 0 keeps each scheduler's default
+    bool adaptiveQuantum = false;
+    long long levelCount = 3;
+    long long boostPeriod = 100;
+    SwitchCosts switchCosts;
+
+    WorkloadOptions workload;
+    bool generating = false;
+    bool seeded = false;
+
+    SweepOptions sweep;
+    sweep.threadCounts.parse("4");
+    sweep.sizes.parse("1");
+    sweep.frequencies.parse("8");
+    sweep.quanta.parse("4");
+    bool sweeping = false;
+    bool analyze = false;
+    bool compare = false;
+    bool runtime = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--help" || option == "-h") {
+            displayUsage();
+            return 0;
+        }
+        if (option == "--analyze") {
+            analyze = true;
+            continue;
+        }
+        if (option == "--compare") {
+            compare = true;
+            continue;
+        }
+        if (option == "--runtime") {
+            runtime = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << option << std::endl;
+            return 1;
+        }
+
+        std::string value = argv[++i];
+        if (option == "--scheduler") {
+            schedulerName = value;
+        } else if (option == "--example") {
+            exampleName = value;
+        } else if (option == "--taskset") {
+            threadSetPath = value;
+        } else if (option == "--horizon") {
+            if (!parseCount(value, horizon)) {
+                std::cerr << "Invalid horizon: " << value << std::endl;
+                return 1;
+            }
+        } else if (option == "--output") {
+            outputName = value;
+        } else if (option == "--trace") {
+            tracePath = value;
+        } else if (option == "--arrivals") {
+            arrivalsPath = value;
+        } else if (option == "--workload") {
+            if (!parseArrivalProcess(value, workload.process)) {
+                std::cerr << "Invalid workload: " << value << std::endl;
+                return 1;
+            }
+            generating = true;
+        } else if (option == "--sizes") {
+            if (!parseSizeDistribution(value, workload.sizes)) {
+                std::cerr << "Invalid size distribution: " << value << std::endl;
+                return 1;
+            }
+            generating = true;
+        } else if (option == "--rate" || option == "--mean-size") {
+            if (!parseRate(value, option == "--rate" ? workload.rate : workload.meanSize)) {
+                std::cerr << "Invalid value for " << option << ": " << value << std::endl;
+                return 1;
+            }
+            generating = true;
+        } else if (option == "--seed") {
+            char* end = nullptr;
+            workload.seed = strtoull(value.c_str(), &end, 10);
+            if (value.empty() || *end != '\0' || value[0] == '-') {
+                std::cerr << "Invalid seed: " << value << std::endl;
+                return 1;
+            }
+            seeded = true;
+            generating = true;
+        } else if (option == "--quantum") {
+            if (value == "adaptive") {
+                adaptiveQuantum = true;
+            } else if (!parseCount(value, quantum) || quantum < 1 || quantum > 1000000) {
+                std::cerr << "Invalid quantum: " << value << std::endl;
+                return 1;
+            }
+        } else if (option == "--levels") {
+            if (!parseCount(value, levelCount) || levelCount < 1 || levelCount > MLFQScheduler::maxLevels) {
+                std::cerr << "Invalid level count: " << value << std::endl;
+                return 1;
+            }
+        } else if (option == "--boost") {
+            if (!parseCount(value, boostPeriod)) {
+                std::cerr << "Invalid boost period: " << value << std::endl;
+                return 1;
+            }
+        } else if (option == "--switch-cost" || option == "--refill-cost") {
+            long long cost;
+            if (!parseCount(value, cost) || cost > 1000000) {
+                std::cerr << "Invalid cost for " << option << ": " << value << std::endl;
+                return 1;
+            }
+            (option == "--switch-cost" ? switchCosts.switchTicks : switchCosts.refillTicks) = static_cast<int>(cost);
+        } else if (option == "--cpus") {
+            if (!parseCount(value, cpuCount) || cpuCount < 1 || cpuCount > 4096) {
+                std::cerr << "Invalid CPU count: " << value << std::endl;
+                return 1;
+            }
+        } else if (option == "--placement") {
+            placementName = value;
+        } else if (option == "--tick-us") {
+            if (!parseCount(value, tickMicros) || tickMicros < 1) {
+                std::cerr << "Invalid tick length: " << value << std::endl;
+                return 1;
+            }
+        } else if (option == "--sweep-threads" || option == "--sweep-size" || option == "--sweep-frequency" ||
+                   option == "--sweep-quantum") {
+            SweepRange& range = option == "--sweep-threads"   ? sweep.threadCounts
+                              : option == "--sweep-size"      ? sweep.sizes
+                              : option == "--sweep-frequency" ? sweep.frequencies
+                                                              : sweep.quanta;
+            if (!range.parse(value)) {
+                std::cerr << "Invalid range for " << option << ": " << value << std::endl;
+                return 1;
+            }
+            sweeping = true;
+        } else if (option == "--workers") {
+            long long workers;
+            if (!parseCount(value, workers) || workers > 4096) {
+                std::cerr << "Invalid worker count: " << value << std::endl;
+                return 1;
+            }
+            sweep.workers = static_cast<unsigned>(workers);
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            displayUsage();
+            return 1;
+        }
+    }
+
+    if (sweeping) {
+        sweep.switchCosts = switchCosts;
+        return runSweepCommand(schedulerName, sweep, horizon);
+    }
+
+    OutputLevel output;
+    if (outputName == "none") {
+        output = OutputLevel::NONE;
+    } else if (outputName == "summary") {
+        output = OutputLevel::SUMMARY;
+    } else if (outputName == "timeline") {
+        output = OutputLevel::TIMELINE;
+    } else if (outputName == "latency") {
+        output = OutputLevel::LATENCY;
+    } else {
+        std::cerr << "Invalid output level: " << outputName << std::endl;
+        return 1;
+    }
+
+    bool starved;
+    if (exampleName == "structured") {
+        starved = false;
+    } else if (exampleName == "starved") {
+        starved = true;
+    } else {
+        std::cerr << "Invalid example: " << exampleName << std::endl;
+        return 1;
+    }
+
+    ArrivalTraceReader arrivalReader;
+    if (!arrivalsPath.empty() && !arrivalReader.open(arrivalsPath)) {
+        return 1;
+    }
+    ArrivalSource* arrivals = arrivalsPath.empty() ? nullptr : &arrivalReader;
+    if (generating && arrivals != nullptr) {
+        std::cerr << "--arrivals replays a trace, it can't be combined with --workload, --rate, --sizes, --mean-size or --seed" << std::endl;
+        return 1;
+    }
+    if (!seeded) {
+        workload.seed = randomSeed();
+    }
+
+    if (schedulerName == "stack" || schedulerName == "queue") {
+        if (!threadSetPath.empty() || !tracePath.empty()) {
+            std::cerr << "--taskset and --trace only apply to rm and rr" << std::endl;
+            return 1;
+        }
+        if (output == OutputLevel::LATENCY) {
+            std::cerr << "--output latency only applies to rm, rr, edf and mlfq" << std::endl;
+            return 1;
+        }
+        if (horizon < 0) {
+            horizon = 10001;
+        }
+        // Stack and queue always take generated arrivals unless a trace is given
+        if (arrivals == nullptr && !prepareWorkload(workload, 1, output)) {
+            return 1;
+        }
+        WorkloadGenerator generator(workload);
+        if (arrivals == nullptr) {
+            arrivals = &generator;
+        }
+        if (schedulerName == "stack") {
+            Stack stackScheduler;
+            stackScheduler.setArrivals(arrivals);
+            stackScheduler.run(horizon, output);
+        } else {
+            Queue queueScheduler;
+            queueScheduler.setArrivals(arrivals);
+            queueScheduler.run(horizon, output);
+        }
+        return arrivalReader.hasFailed() ? 1 : 0;
+    }
+
+    if (schedulerName != "rm" && schedulerName != "rr" && schedulerName != "edf" && schedulerName != "mlfq") {
+        std::cerr << "Choose a scheduler with --scheduler stack|queue|rm|rr|edf|mlfq" << std::endl;
+        return 1;
+    }
+
+    std::vector<Thread> threadSet;
+    if (!threadSetPath.empty()) {
+        if (!loadThreadSet(threadSetPath, threadSet)) {
+            return 1;
+        }
+    } else if (schedulerName == "rm" || schedulerName == "edf") {
+        threadSet = RateMonotonicScheduler::exampleThreadSet(starved ? ExampleType::STARVED : ExampleType::STRUCTURED);
+    } else {
+        threadSet = RoundRobinScheduler::exampleThreadSet(starved ? ExampleType::STARVED : ExampleType::STRUCTURED);
+    }
+    if (horizon < 0) {
+        horizon = 10008;
+    }
+
+    if (schedulerName == "mlfq") {
+        if (runtime || cpuCount > 0 || analyze || !tracePath.empty()) {
+            std::cerr << "--runtime, --cpus, --analyze and --trace don't apply to mlfq" << std::endl;
+            return 1;
+        }
+        if (adaptiveQuantum || switchCosts.any()) {
+            std::cerr << "--quantum adaptive, --switch-cost and --refill-cost only apply to rr" << std::endl;
+            return 1;
+        }
+        if (generating && !prepareWorkload(workload, threadSet.size(), output)) {
+            return 1;
+        }
+        MLFQScheduler mlfqScheduler(threadSet);
+        mlfqScheduler.setLevels(static_cast<int>(levelCount), quantum > 0 ? static_cast<int>(quantum) : 2);
+        mlfqScheduler.setBoostPeriod(boostPeriod);
+        if (compare) {
+            RoundRobinScheduler rrScheduler(threadSet);
+            if (quantum > 0) {
+                rrScheduler.setTimeQuantum(static_cast<int>(quantum));
+            }
+            return compareResponseTimes("RR", rrScheduler, "MLFQ", mlfqScheduler, horizon, arrivalsPath,
+                                        generating ? &workload : nullptr);
+        }
+        WorkloadGenerator generator(workload);
+        mlfqScheduler.setArrivals(generating ? &generator : arrivals);
+        mlfqScheduler.run(horizon, output);
+        return arrivalReader.hasFailed() ? 1 : 0;
+    }
+    if (schedulerName == "rr" && compare) {
+        if (runtime || cpuCount > 0 || analyze || !tracePath.empty()) {
+            std::cerr << "--runtime, --cpus, --analyze and --trace don't apply to rr comparisons" << std::endl;
+            return 1;
+        }
+        if (generating && !prepareWorkload(workload, threadSet.size(), output)) {
+            return 1;
+        }
+        // The fixed quantum is the given one or the default, against the adaptive one
+        RoundRobinScheduler fixedScheduler(threadSet);
+        if (quantum > 0) {
+            fixedScheduler.setTimeQuantum(static_cast<int>(quantum));
+        }
+        fixedScheduler.setSwitchCosts(switchCosts);
+        RoundRobinScheduler adaptiveScheduler(threadSet);
+        adaptiveScheduler.setAdaptiveQuantum(true);
+        adaptiveScheduler.setSwitchCosts(switchCosts);
+        std::string fixedName = "RR q=" + std::to_string(quantum > 0 ? quantum : 4);
+        return compareResponseTimes(fixedName, fixedScheduler, "RR adaptive", adaptiveScheduler, horizon, arrivalsPath,
+                                    generating ? &workload : nullptr);
+    }
+    if (switchCosts.any() && (schedulerName == "edf" || runtime || cpuCount > 0 || compare)) {
+        std::cerr << "--switch-cost and --refill-cost only apply to single CPU rm and rr simulations and sweeps" << std::endl;
+        return 1;
+    }
+    if ((quantum > 0 || adaptiveQuantum) && (schedulerName != "rr" || runtime || cpuCount > 0)) {
+        std::cerr << "--quantum only applies to single CPU rr and mlfq runs" << std::endl;
+        return 1;
+    }
+
+    if ((arrivals != nullptr || generating) && (schedulerName == "edf" || runtime || cpuCount > 0 || analyze || compare)) {
+        std::cerr << "--arrivals and --workload only apply to stack, queue, rm, rr and mlfq runs, without --runtime, --cpus, --analyze or --compare" << std::endl;
+        return 1;
+    }
+
+    if (runtime || cpuCount > 0) {
+        if (output == OutputLevel::LATENCY) {
+            std::cerr << "--output latency only applies to single CPU simulations" << std::endl;
+            return 1;
+        }
+    }
+
+    if (runtime) {
+        if (schedulerName == "edf" || cpuCount > 0 || analyze || compare || !tracePath.empty()) {
+            std::cerr << "--runtime only applies to rm and rr runs, without --cpus, --analyze, --compare or --trace" << std::endl;
+            return 1;
+        }
+        runRuntimeCommand(schedulerName, threadSet, horizon, tickMicros, sweep.workers, output);
+        return 0;
+    }
+
+    if (cpuCount > 0) {
+        if (schedulerName == "edf" || analyze || compare || !tracePath.empty()) {
+            std::cerr << "--cpus only applies to rm and rr runs, without --analyze, --compare or --trace" << std::endl;
+            return 1;
+        }
+        if (placementName != "partitioned" && placementName != "global") {
+            std::cerr << "Invalid placement: " << placementName << std::endl;
+            return 1;
+        }
+        MulticoreScheduler multicoreScheduler(threadSet,
+                                              schedulerName == "rm" ? CorePolicy::RATE_MONOTONIC : CorePolicy::ROUND_ROBIN,
+                                              placementName == "global" ? CorePlacement::GLOBAL : CorePlacement::PARTITIONED,
+                                              static_cast<size_t>(cpuCount));
+        multicoreScheduler.run(horizon, output);
+        return 0;
+    }
+
+    if (analyze) {
+        if (schedulerName != "rm") {
+            std::cerr << "--analyze only applies to rm" << std::endl;
+            return 1;
+        }
+        SchedulabilityReport report = analyzeRateMonotonic(threadSet);
+        printSchedulabilityReport(threadSet, report);
+        if (report.verdict != Schedulability::UNDECIDED && tracePath.empty() && output != OutputLevel::TIMELINE &&
+            output != OutputLevel::LATENCY) {
+            return 0;
+        }
+        if (report.verdict == Schedulability::UNDECIDED) {
+            std::cout << "Falling back to simulation" << std::endl;
+        }
+    }
+
+    if (compare) {
+        compareDeadlineSchedulers(threadSet, horizon);
+        return 0;
+    }
+
+    if (schedulerName == "edf") {
+        if (!tracePath.empty()) {
+            std::cerr << "--trace only applies to rm and rr" << std::endl;
+            return 1;
+        }
+        EDFScheduler edfScheduler(threadSet);
+        edfScheduler.run(horizon, output);
+        return 0;
+    }
+
+    if (generating && !prepareWorkload(workload, threadSet.size(), output)) {
+        return 1;
+    }
+    WorkloadGenerator generator(workload);
+    if (generating) {
+        arrivals = &generator;
+    }
+
+    TraceWriter traceWriter;
+    TraceScheduler traceScheduler = schedulerName == "rm" ? TraceScheduler::RATE_MONOTONIC : TraceScheduler::ROUND_ROBIN;
+    if (!tracePath.empty() && !traceWriter.open(tracePath, traceScheduler, threadSet.size())) {
+        return 1;
+    }
+    TraceWriter* trace = traceWriter.isOpen() ? &traceWriter : nullptr;
+
+    if (schedulerName == "rm") {
+        RateMonotonicScheduler rmsScheduler(threadSet);
+        rmsScheduler.setSwitchCosts(switchCosts);
+        rmsScheduler.setTrace(trace);
+        rmsScheduler.setArrivals(arrivals);
+        rmsScheduler.run(horizon, output);
+    } else {
+        RoundRobinScheduler rrScheduler(threadSet);
+        if (quantum > 0) {
+            rrScheduler.setTimeQuantum(static_cast<int>(quantum));
+        }
+        rrScheduler.setAdaptiveQuantum(adaptiveQuantum);
+        rrScheduler.setSwitchCosts(switchCosts);
+        rrScheduler.setTrace(trace);
+        rrScheduler.setArrivals(arrivals);
+        rrScheduler.run(horizon, output);
+    }
+
+    if (trace != nullptr && !traceWriter.close()) {
+        return 1;
+    }
+    if (arrivalReader.hasFailed()) {
+        return 1;
+    }
+    if (switchCosts.any() && output != OutputLevel::NONE) {
+        // The same run with free switches, to set the throughput above against
+        long long serviced = servicedWithoutSwitchCosts(schedulerName == "rm", threadSet, horizon, quantum, adaptiveQuantum,
+                                                        arrivalsPath, generating ? &workload : nullptr);
+        if (serviced < 0) {
+            return 1;
+        }
+        std::cout << "Without switch costs: " << serviced << " tasks serviced, " << 1000.0 * serviced / horizon
+                  << " tasks per 1000 time units" << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return runCommandLine(argc, argv);
+    }
+
+#ifdef _WIN32
     system("chcp 65001"); // Set UTF-8 code page for Windows cmd
+#endif
 
     char choice;
     bool validInput = false;
@@ -110,15 +821,22 @@ int main() {
                 std::cin >> rmChoice;
 
                 if (rmChoice == '1') {  // Run Structured example
-                    RateMonotonicScheduler rmsScheduler(RateMonotonicScheduler::ExampleType::STRUCTURED);
+                    RateMonotonicScheduler rmsScheduler(ExampleType::STRUCTURED);
                     rmsScheduler.runExample();
                     rmValidInput = true;
                 } else if (rmChoice == '2') {  // Run Starved example
-                    RateMonotonicScheduler rmsScheduler(RateMonotonicScheduler::ExampleType::STARVED);
+                    RateMonotonicScheduler rmsScheduler(ExampleType::STARVED);
                     rmsScheduler.runExample();
                     rmValidInput = true;
+                } else if (rmChoice == '3') {  // Run a thread set from a file
+                    std::vector<Thread> threadSet;
+                    if (promptThreadSet(threadSet)) {
+                        RateMonotonicScheduler rmsScheduler(threadSet);
+                        rmsScheduler.runExample();
+                        rmValidInput = true;
+                    }
                 } else {
-                    std::cout << "Invalid input. Please enter '1' for Structured or '2' for Starved." << std::endl;
+                    std::cout << "Invalid input. Please enter '1' for Structured, '2' for Starved or '3' for a file." << std::endl;
                 }
             }
             validInput = true;
@@ -133,15 +851,82 @@ int main() {
                 std::cin >> rrChoice;
 
                 if (rrChoice == '1') {  // Run Structured example
-                    RoundRobinScheduler rrScheduler(RoundRobinScheduler::ExampleType::STRUCTURED);
+                    RoundRobinScheduler rrScheduler(ExampleType::STRUCTURED);
                     rrScheduler.runExample();
                     rrValidInput = true;
                 } else if (rrChoice == '2') {  // Run Starved example
-                    RoundRobinScheduler rrScheduler(RoundRobinScheduler::ExampleType::STARVED);
+                    RoundRobinScheduler rrScheduler(ExampleType::STARVED);
                     rrScheduler.runExample();
                     rrValidInput = true;
+                } else if (rrChoice == '3') {  // Run a thread set from a file
+                    std::vector<Thread> threadSet;
+                    if (promptThreadSet(threadSet)) {
+                        RoundRobinScheduler rrScheduler(threadSet);
+                        rrScheduler.runExample();
+                        rrValidInput = true;
+                    }
+                } else {
+                    std::cout << "Invalid input. Please enter '1' for Structured, '2' for Starved or '3' for a file." << std::endl;
+                }
+            }
+            validInput = true;
+        } else if (choice == '3') {  // Earliest Deadline First Scheduler
+            char edfChoice;
+            bool edfValidInput = false;
+
+            // Display the Earliest Deadline First options menu
+            while (!edfValidInput) {
+                displayEarliestDeadlineFirstOptions();
+                std::cout << "Enter your choice: ";
+                std::cin >> edfChoice;
+
+                if (edfChoice == '1') {  // Run Structured example
+                    EDFScheduler edfScheduler(ExampleType::STRUCTURED);
+                    edfScheduler.runExample();
+                    edfValidInput = true;
+                } else if (edfChoice == '2') {  // Run Starved example
+                    EDFScheduler edfScheduler(ExampleType::STARVED);
+                    edfScheduler.runExample();
+                    edfValidInput = true;
+                } else if (edfChoice == '3') {  // Run a thread set from a file
+                    std::vector<Thread> threadSet;
+                    if (promptThreadSet(threadSet)) {
+                        EDFScheduler edfScheduler(threadSet);
+                        edfScheduler.runExample();
+                        edfValidInput = true;
+                    }
+                } else {
+                    std::cout << "Invalid input. Please enter '1' for Structured, '2' for Starved or '3' for a file." << std::endl;
+                }
+            }
+            validInput = true;
+        } else if (choice == '4') {  // Multilevel Feedback Queue Scheduler
+            char mlfqChoice;
+            bool mlfqValidInput = false;
+
+            // Display the Multilevel Feedback Queue options menu
+            while (!mlfqValidInput) {
+                displayFeedbackQueueOptions();
+                std::cout << "Enter your choice: ";
+                std::cin >> mlfqChoice;
+
+                if (mlfqChoice == '1') {  // Run Structured example
+                    MLFQScheduler mlfqScheduler(ExampleType::STRUCTURED);
+                    mlfqScheduler.runExample();
+                    mlfqValidInput = true;
+                } else if (mlfqChoice == '2') {  // Run Starved example
+                    MLFQScheduler mlfqScheduler(ExampleType::STARVED);
+                    mlfqScheduler.runExample();
+                    mlfqValidInput = true;
+                } else if (mlfqChoice == '3') {  // Run a thread set from a file
+                    std::vector<Thread> threadSet;
+                    if (promptThreadSet(threadSet)) {
+                        MLFQScheduler mlfqScheduler(threadSet);
+                        mlfqScheduler.runExample();
+                        mlfqValidInput = true;
+                    }
                 } else {
-                    std::cout << "Invalid input. Please enter '1' for Structured or '2' for Starved." << std::endl;
+                    std::cout << "Invalid input. Please enter '1' for Structured, '2' for Starved or '3' for a file." << std::endl;
                 }
             }
             validInput = true;
@@ -0,0 +1,121 @@
+/**
+ * @file TraceReplay.cpp
+ * @brief Schedule trace replay viewer
+ *
+ * Draws any window of a recorded rate monotonic or round robin trace
+ * with the same colors as the live display, without re-running the scheduler.
+ * The trace is memory mapped and the window is found through its block index.
+ *
+ * Usage: trace_replay FILE [--start TICK] [--count TICKS]
+ *
+ * @date 10/16/26
+ * @authors Fiya Clerget, Marcello Novak
+ */
+
+#include "ASCII.h"
+#include "ScheduleTrace.h"
+#include "TimelineRenderer.h"
+#include <algorithm>  // For min
+#include <iostream>
+#include <stdlib.h>  // For strtoll
+#include <string>
+#include <vector>
+
+// Draw one tick with the colors runTicks uses for the scheduler that recorded it
+static void drawTick(TimelineRenderer& renderer, TraceScheduler scheduler, const TraceTick& tick,
+                     const std::vector<long long>& pending, std::vector<bool>& taskCreated) {
+    taskCreated.assign(pending.size(), false);
+    for (size_t threadIndex : tick.releases) {
+        taskCreated[threadIndex] = true;
+    }
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        bool isRunning = (static_cast<int>(i) == tick.runningThread);
+        bool isCreated = taskCreated[i];
+        bool hasTask = pending[i] > 0;
+
+        if (scheduler == TraceScheduler::RATE_MONOTONIC) {
+            if (isRunning && isCreated) {
+                renderer.writeCell(COLOR_TURQUOISE, "█▓▒░");
+            } else if (isRunning) {
+                renderer.writeCell(COLOR_GREEN, "█▓▒░");
+            } else if (isCreated) {
+                renderer.writeCell(COLOR_YELLOW, "█▓▒░");
+            } else if (hasTask && tick.runningThread != -1 && static_cast<int>(i) > tick.runningThread) {
+                renderer.writeCell(COLOR_RED, "█▓▒░");
+            } else {
+                renderer.writeCell(COLOR_GRAY, "░░░░");
+            }
+        } else {
+            if (isRunning && isCreated && hasTask) {
+                renderer.writeCell(COLOR_TURQUOISE, "█▓▒░");
+            } else if (isRunning && hasTask) {
+                renderer.writeCell(COLOR_GREEN, "█▓▒░");
+            } else if (isRunning) {
+                renderer.writeCell(COLOR_ORANGE, "█▓▒░");
+            } else if (isCreated) {
+                renderer.writeCell(COLOR_YELLOW, "█▓▒░");
+            } else if (hasTask) {
+                renderer.writeCell(COLOR_RED, "█▓▒░");
+            } else {
+                renderer.writeCell(COLOR_GRAY, "░░░░");
+            }
+        }
+    }
+    renderer.endRow(tick.time + 1);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: trace_replay FILE [--start TICK] [--count TICKS]" << std::endl;
+        return 1;
+    }
+
+    long long start = 0;
+    long long count = 240;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        long long value = strtoll(argv[i + 1], nullptr, 10);
+        if (option == "--start" && value >= 0) {
+            start = value;
+        } else if (option == "--count" && value >= 0) {
+            count = value;
+        } else {
+            std::cerr << "Invalid option: " << option << " " << argv[i + 1] << std::endl;
+            return 1;
+        }
+    }
+
+    TraceReader reader;
+    if (!reader.open(argv[1])) {
+        return 1;
+    }
+    if (start >= reader.tickCount()) {
+        std::cerr << "Trace only has " << reader.tickCount() << " ticks, --start must be below that" << std::endl;
+        return 1;
+    }
+    if (!reader.seek(start)) {
+        std::cerr << "Trace is corrupt before tick " << start << std::endl;
+        return 1;
+    }
+
+    const int frameBoundary = 24;
+    TimelineRenderer renderer;
+    TraceTick tick;
+    std::vector<bool> taskCreated;
+    // The window stops at the end of the trace, so any tick in it that fails to decode is corrupt
+    long long end = start + std::min(count, reader.tickCount() - start);
+    for (long long time = start; time < end; ++time) {
+        if (!reader.next(tick)) {
+            renderer.flush();
+            std::cerr << "Trace is corrupt at tick " << time << std::endl;
+            return 1;
+        }
+        if (time == start || time % frameBoundary == 0) {
+            renderer.newFrame();
+        }
+        drawTick(renderer, reader.scheduler(), tick, reader.pending(), taskCreated);
+    }
+    renderer.flush();
+    return 0;
+}